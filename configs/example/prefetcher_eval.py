@@ -0,0 +1,186 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Evaluates a hardware prefetcher offline, by replaying a memory access
+trace through a single cache backed by a fixed latency memory, without
+simulating any core. The trace is a gem5 packet trace, as recorded by a
+MemTraceProbe attached to the CPU side of the cache of interest in a
+full simulation, so that the prefetcher sees the same access stream.
+
+Each run evaluates a single configuration; sweeps are done by launching
+one run per configuration, e.g.:
+
+    build/ALL/gem5.opt -d m5out/stride4 configs/example/prefetcher_eval.py \
+        --trace l2.trc.gz --prefetcher StridePrefetcher --param degree=4
+
+At the end of the run the accuracy, coverage, timeliness and pollution of
+the prefetcher are printed, and all the statistics are dumped as usual.
+"""
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    description=__doc__, formatter_class=argparse.RawTextHelpFormatter
+)
+parser.add_argument(
+    "--trace", required=True, help="Packet trace of the accesses to replay"
+)
+parser.add_argument(
+    "--warmup-trace",
+    default=None,
+    help="Packet trace used to functionally warm the cache and the "
+    "prefetcher before the replay",
+)
+parser.add_argument(
+    "--prefetcher",
+    default=None,
+    choices=ObjectList.hwp_list.get_names(),
+    help="Prefetcher to evaluate, none by default",
+)
+parser.add_argument(
+    "--param",
+    action="append",
+    default=[],
+    metavar="NAME=VALUE",
+    help="Set a parameter of the prefetcher, may be repeated",
+)
+parser.add_argument("--cache-size", default="1MiB", help="Cache size")
+parser.add_argument("--cache-assoc", type=int, default=16)
+parser.add_argument(
+    "--cache-latency", type=int, default=12, help="Cache latency in cycles"
+)
+parser.add_argument("--mshrs", type=int, default=32)
+parser.add_argument("--mem-latency", default="60ns", help="Memory latency")
+parser.add_argument(
+    "--mem-bandwidth", default="25.6GiB/s", help="Memory bandwidth"
+)
+parser.add_argument(
+    "--mem-size",
+    default="16GiB",
+    help="Size of the memory, which must cover the addresses of the trace",
+)
+parser.add_argument(
+    "--pollution-filter-size",
+    type=int,
+    default=4096,
+    help="Entries of the filter of the blocks evicted by prefetches, 0 "
+    "disables the pollution tracking",
+)
+
+args = parser.parse_args()
+
+system = System()
+system.clk_domain = SrcClockDomain(
+    clock="2GHz", voltage_domain=VoltageDomain(voltage="1V")
+)
+system.mem_mode = "timing"
+system.mem_ranges = [AddrRange(args.mem_size)]
+system.cache_line_size = 64
+# the memory does not store data, do not reserve space for it either
+system.mmap_using_noreserve = True
+
+system.tgen = PyTrafficGen()
+
+system.cache = Cache(
+    size=args.cache_size,
+    assoc=args.cache_assoc,
+    tag_latency=args.cache_latency,
+    data_latency=args.cache_latency,
+    response_latency=args.cache_latency,
+    mshrs=args.mshrs,
+    tgts_per_mshr=16,
+    write_buffers=16,
+)
+
+if args.prefetcher:
+    pf = ObjectList.hwp_list.get(args.prefetcher)()
+    for param in args.param:
+        name, sep, value = param.partition("=")
+        if not sep:
+            fatal("Malformed prefetcher parameter '%s'" % param)
+        setattr(pf, name, value)
+    if args.pollution_filter_size:
+        pf.pollution_filter = BloomFilterBlock(size=args.pollution_filter_size)
+    system.cache.prefetcher = pf
+
+system.mem = SimpleMemory(
+    range=system.mem_ranges[0],
+    latency=args.mem_latency,
+    bandwidth=args.mem_bandwidth,
+    null=True,
+)
+
+system.tgen.port = system.cache.cpu_side
+system.cache.mem_side = system.mem.port
+
+root = Root(full_system=False, system=system)
+m5.instantiate()
+
+if args.warmup_trace:
+    system.cache.warmupFromTrace(args.warmup_trace)
+
+
+def replay():
+    # run the trace to its end, then stop the simulation
+    yield system.tgen.createTrace(m5.MaxTick, args.trace)
+    yield system.tgen.createExit(0)
+
+
+system.tgen.start(replay())
+exit_event = m5.simulate()
+print("Exiting @ tick %i because %s" % (m5.curTick(), exit_event.getCause()))
+
+
+def stat(name):
+    return system.cache.prefetcher.resolveStat(name).value
+
+
+def ratio(num, den):
+    return num / den if den else float("nan")
+
+
+if args.prefetcher:
+    useful = stat("pfUseful")
+    too_late = stat("pfUsefulTooLate")
+    misses = stat("demandMshrMisses")
+    print("Prefetches issued:  %d" % stat("pfIssued"))
+    print("Accuracy:           %.4f" % ratio(useful, stat("pfIssued")))
+    print("Coverage:           %.4f" % ratio(useful, useful + misses))
+    print("Timeliness:         %.4f" % ratio(useful, useful + too_late))
+    if args.pollution_filter_size:
+        print(
+            "Pollution:          %.4f" % ratio(stat("pfPollution"), misses)
+        )
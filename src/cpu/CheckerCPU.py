@@ -44,6 +44,20 @@ class CheckerCPU(BaseCPU):
         True,
         "If a load result is incorrect, only print a warning and do not exit",
     )
+    checkInterval = Param.Counter(
+        0,
+        "Only compare a digest of the architectural registers and of the "
+        "stored data with the checked CPU every this many instructions, "
+        "and on syscalls and interrupts, instead of validating every "
+        "instruction (0 validates every instruction)",
+    )
+    checkLength = Param.Counter(
+        0,
+        "Only execute the first this many instructions of every "
+        "checkInterval, and skip the others, copying the architectural "
+        "state of the checked CPU before the next interval starts (0 "
+        "executes every instruction)",
+    )
 
     def generateDeviceTree(self, state):
         # The CheckerCPU is not a real CPU and shouldn't generate a DTB
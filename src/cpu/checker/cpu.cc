@@ -67,7 +67,8 @@ CheckerCPU::CheckerCPU(const Params &p)
       systemPtr(NULL), icachePort(NULL), dcachePort(NULL),
       tc(NULL), thread(NULL),
       unverifiedReq(nullptr),
-      unverifiedMemData(nullptr)
+      unverifiedMemData(nullptr),
+      checkerStats(this)
 {
     curStaticInst = NULL;
     curMacroStaticInst = NULL;
@@ -82,6 +83,16 @@ CheckerCPU::CheckerCPU(const Params &p)
 
     exitOnError = p.exitOnError;
     warnOnlyOnLoadError = p.warnOnlyOnLoadError;
+    checkInterval = p.checkInterval;
+    instsSinceCheck = 0;
+    checkLength = p.checkLength;
+    skipping = false;
+    instsSkipped = 0;
+    resyncPC = false;
+    checkPending = false;
+    storeDigest = unverifiedStoreDigest = digestSeed;
+    fatal_if(checkLength && checkLength >= checkInterval,
+             "%s: checkLength must be smaller than checkInterval", name());
     mmu = p.mmu;
     workload = p.workload;
 
@@ -338,7 +349,15 @@ CheckerCPU::writeMem(uint8_t *data, unsigned size,
        data = zero_data;
    }
 
-   if (unverifiedReq && unverifiedMemData &&
+   if (checkInterval) {
+       // Only accumulate the stored data, it is compared with the rest of
+       // the state at the end of the interval.
+       if (unverifiedReq && unverifiedMemData && extraData) {
+           storeDigest = digestBytes(storeDigest, data, size);
+           unverifiedStoreDigest = digestBytes(unverifiedStoreDigest,
+                                               unverifiedMemData, size);
+       }
+   } else if (unverifiedReq && unverifiedMemData &&
        memcmp(data, unverifiedMemData, size) && extraData) {
            warn("%lli: Store value does not match value sent to memory! "
                   "data: %#x inst_data: %#x", curTick(), data,
@@ -369,6 +388,104 @@ CheckerCPU::checkFlags(const RequestPtr &unverified_req, Addr vAddr,
     return true;
 }
 
+uint64_t
+CheckerCPU::digestBytes(uint64_t digest, const void *data, size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+        digest ^= bytes[i];
+        digest *= 0x100000001b3ULL;
+    }
+    return digest;
+}
+
+namespace
+{
+
+/** Register classes covered by the interval state comparison. */
+const RegClassType digestRegClasses[] = {
+    IntRegClass, FloatRegClass, VecRegClass, VecPredRegClass, MatRegClass,
+    CCRegClass
+};
+
+} // anonymous namespace
+
+uint64_t
+CheckerCPU::archStateDigest(ThreadContext *context) const
+{
+    const auto &reg_classes = context->getIsaPtr()->regClasses();
+
+    uint64_t digest = digestSeed;
+    std::vector<uint8_t> val;
+    for (auto type: digestRegClasses) {
+        const RegClass &reg_class = *reg_classes.at(type);
+        val.resize(reg_class.regBytes());
+        for (auto &id: reg_class) {
+            context->getReg(id, val.data());
+            digest = digestBytes(digest, val.data(), val.size());
+        }
+    }
+    return digest;
+}
+
+bool
+CheckerCPU::checkArchState(ThreadContext *context)
+{
+    ++checkerStats.intervalChecks;
+
+    bool match = true;
+    if (archStateDigest(tc) != archStateDigest(context)) {
+        // Only walk the registers again to report the differences.
+        const auto &reg_classes = tc->getIsaPtr()->regClasses();
+        std::vector<uint8_t> checker_val, inst_val;
+        for (auto type: digestRegClasses) {
+            const RegClass &reg_class = *reg_classes.at(type);
+            checker_val.resize(reg_class.regBytes());
+            inst_val.resize(reg_class.regBytes());
+            for (auto &id: reg_class) {
+                tc->getReg(id, checker_val.data());
+                context->getReg(id, inst_val.data());
+                if (checker_val != inst_val) {
+                    warn("%lli: %s reg %i does not match! Inst: %s, "
+                         "checker: %s", curTick(), id.className(),
+                         id.index(), reg_class.valString(inst_val.data()),
+                         reg_class.valString(checker_val.data()));
+                }
+            }
+        }
+        match = false;
+    }
+
+    if (storeDigest != unverifiedStoreDigest) {
+        warn("%lli: Data stored in the last %lli instructions does not "
+             "match the data sent to memory!", curTick(), instsSinceCheck);
+        match = false;
+    }
+
+    DPRINTF(Checker, "Compared state after %lli instructions: %s\n",
+            instsSinceCheck, match ? "match" : "mismatch");
+
+    if (!match)
+        ++checkerStats.intervalMismatches;
+
+    instsSinceCheck = 0;
+    checkPending = false;
+    storeDigest = unverifiedStoreDigest = digestSeed;
+
+    return match;
+}
+
+CheckerCPU::CheckerStats::CheckerStats(statistics::Group *parent)
+    : statistics::Group(parent, "checker"),
+      ADD_STAT(intervalChecks, statistics::units::Count::get(),
+               "Number of interval architectural state comparisons"),
+      ADD_STAT(intervalMismatches, statistics::units::Count::get(),
+               "Number of interval comparisons that found a mismatch"),
+      ADD_STAT(skippedInsts, statistics::units::Count::get(),
+               "Number of instructions skipped between intervals")
+{
+}
+
 void
 CheckerCPU::dumpAndExit()
 {
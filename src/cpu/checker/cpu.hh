@@ -42,6 +42,7 @@
 #ifndef __CPU_CHECKER_CPU_HH__
 #define __CPU_CHECKER_CPU_HH__
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <queue>
@@ -418,6 +419,29 @@ class CheckerCPU : public BaseCPU, public ExecContext
     bool checkFlags(const RequestPtr &unverified_req, Addr vAddr,
                     Addr pAddr, int flags);
 
+    /** Initial value of the state and store digests. */
+    static constexpr uint64_t digestSeed = 0xcbf29ce484222325ULL;
+
+    /** Folds a block of bytes into a running FNV-1a digest. */
+    static uint64_t digestBytes(uint64_t digest, const void *data,
+                                size_t size);
+
+    /**
+     * Computes a digest of the non-misc architectural registers of a
+     * thread context.
+     */
+    uint64_t archStateDigest(ThreadContext *context) const;
+
+    /**
+     * Compares the architectural state of the checker with that of the
+     * checked CPU, along with the digests of the data each of them
+     * stored since the previous check. Prints the mismatching
+     * registers, if any.
+     * @param context The thread context of the checked CPU.
+     * @return Whether the states match.
+     */
+    bool checkArchState(ThreadContext *context);
+
     void dumpAndExit();
 
     ThreadContext *tcBase() const override { return tc; }
@@ -434,7 +458,47 @@ class CheckerCPU : public BaseCPU, public ExecContext
     bool updateOnError;
     bool warnOnlyOnLoadError;
 
+    /**
+     * Number of instructions between two comparisons of the
+     * architectural state. Zero validates every instruction instead.
+     */
+    Counter checkInterval;
+    /** Instructions executed since the last state comparison. */
+    Counter instsSinceCheck;
+    /**
+     * Number of instructions executed at the start of every interval,
+     * the rest of the interval is skipped. Zero executes them all.
+     */
+    Counter checkLength;
+    /** Whether the instructions are currently skipped. */
+    bool skipping;
+    /** Instructions skipped in the current interval. */
+    Counter instsSkipped;
+    /**
+     * Whether the registers were copied from the checked CPU and the PC
+     * must be taken from the next instruction.
+     */
+    bool resyncPC;
+    /** Whether a state comparison is due at the next safe point. */
+    bool checkPending;
+    /** Digest of the data stored by the checker since the last check. */
+    uint64_t storeDigest;
+    /** Digest of the data stored by the checked CPU since the last check. */
+    uint64_t unverifiedStoreDigest;
+
     InstSeqNum youngestSN;
+
+    struct CheckerStats : public statistics::Group
+    {
+        CheckerStats(statistics::Group *parent);
+
+        /** Number of interval state comparisons. */
+        statistics::Scalar intervalChecks;
+        /** Number of interval state comparisons that found a mismatch. */
+        statistics::Scalar intervalMismatches;
+        /** Number of instructions skipped between intervals. */
+        statistics::Scalar skippedInsts;
+    } checkerStats;
 };
 
 /**
@@ -479,6 +543,20 @@ class Checker : public CheckerCPU
 
     void dumpAndExit(const DynInstPtr &inst);
 
+    /**
+     * Skips an instruction outside of the checked part of an interval,
+     * and copies the state of the checked CPU once the next interval is
+     * due and the instruction is at a safe point.
+     */
+    void skipInst(const DynInstPtr &inst);
+
+    /**
+     * Makes the next completed instruction waiting in instList the
+     * unverified instruction.
+     * @return Whether there was such an instruction.
+     */
+    bool nextCompletedInst();
+
     bool updateThisCycle;
 
     DynInstPtr unverifiedInst;
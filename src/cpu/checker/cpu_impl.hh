@@ -101,6 +101,10 @@ Checker<DynInstPtr>::handlePendingInt()
         verify(inst); // verify the instructions
         inst = NULL;
     }
+
+    // Compare the state at the next instruction boundary.
+    if (checkInterval && !skipping)
+        checkPending = true;
     if ((!boundaryInst && curMacroStaticInst &&
           curStaticInst->isDelayedCommit() &&
           !curStaticInst->isLastMicroop()) ||
@@ -187,6 +191,13 @@ Checker<DynInstPtr>::verify(const DynInstPtr &completed_inst)
     // run out of instructions to check or if an instruction is not
     // yet completed.
     while (1) {
+        if (skipping) {
+            skipInst(unverifiedInst);
+            if (!nextCompletedInst())
+                break;
+            continue;
+        }
+
         DPRINTF(Checker, "Processing instruction [sn:%lli] PC:%s.\n",
                 unverifiedInst->seqNum, unverifiedInst->pcState());
         unverifiedReq = NULL;
@@ -200,6 +211,13 @@ Checker<DynInstPtr>::verify(const DynInstPtr &completed_inst)
 
         Fault fault = NoFault;
 
+        // The registers were copied from the checked CPU after the last
+        // skipped instruction, resume from this one.
+        if (resyncPC) {
+            thread->pcState(unverifiedInst->pcState());
+            resyncPC = false;
+        }
+
         // Check if any recent PC changes match up with anything we
         // expect to happen.  This is mostly to check if traps or
         // PC-based events have occurred in both the checker and CPU.
@@ -332,8 +350,10 @@ Checker<DynInstPtr>::verify(const DynInstPtr &completed_inst)
             unverifiedFault = unverifiedInst->getFault();
 
             // Checks that the instruction matches what we expected it to be.
-            // Checks both the machine instruction and the PC.
-            validateInst(unverifiedInst);
+            // Checks both the machine instruction and the PC. In interval
+            // mode a divergence shows up in the next state comparison.
+            if (!checkInterval)
+                validateInst(unverifiedInst);
         }
 
         // keep an instruction count
@@ -359,8 +379,16 @@ Checker<DynInstPtr>::verify(const DynInstPtr &completed_inst)
             }
 
             if (fault == NoFault && unverifiedFault == NoFault) {
-                // Checks to make sure instrution results are correct.
-                validateExecution(unverifiedInst);
+                // Checks to make sure instrution results are correct. In
+                // interval mode, only the instructions whose results the
+                // checker may have to copy are validated one by one.
+                if (!checkInterval || unverifiedInst->isUnverifiable() ||
+                        unverifiedInst->isLoad()) {
+                    validateExecution(unverifiedInst);
+                } else {
+                    while (!miscRegIdxs.empty())
+                        miscRegIdxs.pop();
+                }
 
                 if (curStaticInst->isLoad()) {
                     ++numLoad;
@@ -411,21 +439,83 @@ Checker<DynInstPtr>::verify(const DynInstPtr &completed_inst)
         // that have been modified).
         validateState();
 
+        if (checkInterval) {
+            if (++instsSinceCheck >= (checkLength ? checkLength :
+                                                    checkInterval) ||
+                    unverifiedInst->isSyscall()) {
+                checkPending = true;
+            }
+
+            // The checked CPU has already updated its state past a
+            // faulting instruction's trap or an instruction waiting in
+            // instList, so only compare once the checker has caught up.
+            if (checkPending && fault == NoFault && instList.empty() &&
+                    !curMacroStaticInst) {
+                if (!checkArchState(unverifiedInst->tcBase()))
+                    handleError(unverifiedInst);
+
+                // Skip the rest of the interval.
+                if (checkLength)
+                    skipping = true;
+            }
+        }
+
         // Continue verifying instructions if there's another completed
         // instruction waiting to be verified.
-        if (instList.empty()) {
+        if (!nextCompletedInst())
             break;
-        } else if (instList.front()->isCompleted()) {
-            unverifiedInst = NULL;
-            unverifiedInst = instList.front();
-            instList.pop_front();
-        } else {
-            break;
-        }
     }
     unverifiedInst = NULL;
 }
 
+template <class DynInstPtr>
+bool
+Checker<DynInstPtr>::nextCompletedInst()
+{
+    if (instList.empty() || !instList.front()->isCompleted())
+        return false;
+
+    unverifiedInst = instList.front();
+    instList.pop_front();
+    return true;
+}
+
+template <class DynInstPtr>
+void
+Checker<DynInstPtr>::skipInst(const DynInstPtr &inst)
+{
+    ++checkerStats.skippedInsts;
+
+    // The registers of the checked CPU only match the state right after
+    // this instruction if nothing younger has committed yet, and the
+    // next instruction must start a macro-op.
+    if (++instsSkipped < checkInterval - checkLength ||
+            !instList.empty() || inst->getFault() != NoFault ||
+            (inst->isMicroop() && !inst->isLastMicroop())) {
+        return;
+    }
+
+    DPRINTF(Checker, "Copying the state of the checked CPU after "
+            "[sn:%lli] PC:%s\n", inst->seqNum, inst->pcState());
+
+    bool no_squash_from_TC = inst->thread->noSquashFromTC;
+    inst->thread->noSquashFromTC = true;
+    thread->copyArchRegs(inst->tcBase());
+    inst->thread->noSquashFromTC = no_squash_from_TC;
+
+    thread->decoder->reset();
+    curMacroStaticInst = nullStaticInstPtr;
+    changedPC = false;
+    willChangePC = false;
+    resyncPC = true;
+
+    skipping = false;
+    instsSkipped = 0;
+    instsSinceCheck = 0;
+    checkPending = false;
+    storeDigest = unverifiedStoreDigest = digestSeed;
+}
+
 template <class DynInstPtr>
 void
 Checker<DynInstPtr>::switchOut()
@@ -39,6 +39,7 @@
 
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #include "cpu/base.hh"
 #include "cpu/minor/trace.hh"
@@ -75,6 +76,56 @@ operator <<(std::ostream &os, const InstId &id)
     return os;
 }
 
+namespace
+{
+
+/** Free list of MinorDynInst sized blocks.  This is thread local as CPUs
+ *  on different event queues can run in different host threads */
+struct DynInstPool
+{
+    /** Most blocks to keep around.  This is well above the number of
+     *  instructions in flight in any reasonable Minor configuration */
+    static const std::size_t maxFree = 1024;
+
+    std::vector<void *> freeBlocks;
+
+    ~DynInstPool()
+    {
+        for (void *block : freeBlocks)
+            ::operator delete(block);
+    }
+};
+
+thread_local DynInstPool dynInstPool;
+
+} // anonymous namespace
+
+void *
+MinorDynInst::operator new(std::size_t size)
+{
+    auto &free_blocks = dynInstPool.freeBlocks;
+
+    if (size != sizeof(MinorDynInst) || free_blocks.empty())
+        return ::operator new(size);
+
+    void *block = free_blocks.back();
+    free_blocks.pop_back();
+    return block;
+}
+
+void
+MinorDynInst::operator delete(void *ptr, std::size_t size)
+{
+    auto &free_blocks = dynInstPool.freeBlocks;
+
+    if (size != sizeof(MinorDynInst) ||
+        free_blocks.size() >= DynInstPool::maxFree) {
+        ::operator delete(ptr);
+    } else {
+        free_blocks.push_back(ptr);
+    }
+}
+
 MinorDynInstPtr MinorDynInst::bubbleInst = []() {
     auto *inst = new MinorDynInst(nullStaticInstPtr);
     assert(inst->isBubble());
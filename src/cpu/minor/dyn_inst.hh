@@ -46,6 +46,7 @@
 #ifndef __CPU_MINOR_DYN_INST_HH__
 #define __CPU_MINOR_DYN_INST_HH__
 
+#include <cstddef>
 #include <iostream>
 
 #include "arch/generic/isa.hh"
@@ -281,6 +282,12 @@ class MinorDynInst : public RefCounted
 
     void setMemAccPredicate(bool val) { memAccPredicate = val; }
 
+    /** MinorDynInsts are created and destroyed at the rate instructions
+     *  flow through the pipeline.  Recycle their storage through a free
+     *  list rather than going to the heap each time */
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr, std::size_t size);
+
     ~MinorDynInst();
 };
 
@@ -598,6 +598,12 @@ Fetch2::isDrained()
            (*predictionOut.inputWire).isBubble();
 }
 
+bool
+Fetch2::isIdle()
+{
+    return isDrained() && (*branchInp.outputWire).isBubble();
+}
+
 Fetch2::Fetch2Stats::Fetch2Stats(MinorCPU *cpu)
       : statistics::Group(cpu, "fetch2"),
       ADD_STAT(intInstructions, statistics::units::Count::get(),
@@ -218,6 +218,10 @@ class Fetch2 : public Named
      *  Execute halting Fetch1 causing Fetch2 to naturally drain.
      *  Branch predictions are ignored by Fetch1 during halt */
     bool isDrained();
+
+    /** Does this stage have nothing to do this cycle?  That is, no input
+     *  lines, either buffered or arriving, and no branch from Execute */
+    bool isIdle();
 };
 
 } // namespace minor
@@ -131,8 +131,19 @@ Pipeline::evaluate()
      *  'immediate', 0-time-offset TimeBuffer activity to be visible from
      *  later stages to earlier ones in the same cycle */
     execute.evaluate();
-    decode.evaluate();
-    fetch2.evaluate();
+
+    /* Decode and Fetch2 only act on their input.  Without any, evaluating
+     *  them would produce only bubbles, which is what their output latches
+     *  already hold, so skip them.  MinorTrace reports the stages' blocked
+     *  state which is only refreshed by evaluate, so keep evaluating them
+     *  when tracing */
+    bool trace_stages = debug::MinorTrace;
+
+    if (trace_stages || !decode.isDrained())
+        decode.evaluate();
+    if (trace_stages || !fetch2.isIdle())
+        fetch2.evaluate();
+
     fetch1.evaluate();
 
     if (debug::MinorTrace)
@@ -45,6 +45,7 @@ from m5.objects.FUPool import *
 
 # from m5.objects.O3Checker import O3Checker
 from m5.objects.BranchPredictor import *
+from m5.objects.ValuePredictor import *
 
 
 class SMTFetchPolicy(ScopedEnum):
@@ -92,6 +93,16 @@ class BaseO3CPU(BaseCPU):
     fetchQueueSize = Param.Unsigned(
         32, "Fetch queue size in micro-ops per-thread"
     )
+    fetchTargetQueueSize = Param.Unsigned(
+        0,
+        "Number of fetch blocks the BTB may run ahead of fetch to drive "
+        "fetch-directed instruction prefetching (0 disables it)",
+    )
+    fetchTargetPrefetchWidth = Param.Unsigned(
+        1,
+        "Maximum number of I-cache prefetches issued from the fetch target "
+        "queue per cycle",
+    )
 
     renameToDecodeDelay = Param.Cycles(1, "Rename to decode delay")
     iewToDecodeDelay = Param.Cycles(
@@ -191,4 +202,7 @@ class BaseO3CPU(BaseCPU):
     branchPred = Param.BranchPredictor(
         TournamentBP(numThreads=Parent.numThreads), "Branch Predictor"
     )
+    valuePred = Param.ValuePredictor(
+        NULL, "Load value predictor (NULL disables value prediction)"
+    )
     needsTSO = Param.Bool(False, "Enable TSO Memory model")
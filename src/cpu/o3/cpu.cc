@@ -311,6 +311,8 @@ CPU::regProbePoints()
     ppDataAccessComplete = new ProbePointArg<
         std::pair<DynInstPtr, PacketPtr>>(
                 getProbeManager(), "DataAccessComplete");
+    ppRetiredLoadAccess = new ProbePointArg<PacketPtr>(
+            getProbeManager(), "RetiredLoadAccess");
 
     fetch.regProbePoints();
     rename.regProbePoints();
@@ -1136,6 +1138,17 @@ CPU::instDone(ThreadID tid, const DynInstPtr &inst)
     commitStats[tid]->numOpsNotNOP++;
 
     probeInstCommit(inst->staticInst, inst->pcState().instAddr());
+
+    if (inst->isLoad() && inst->effAddrValid() && !inst->strictlyOrdered() &&
+            ppRetiredLoadAccess->hasListeners()) {
+        RequestPtr req = std::make_shared<Request>(
+                inst->effAddr, inst->effSize, inst->memReqFlags,
+                dataRequestorId(), inst->pcState().instAddr(),
+                inst->contextId());
+        req->setPaddr(inst->physEffAddr);
+        Packet pkt(req, MemCmd::ReadReq);
+        ppRetiredLoadAccess->notify(&pkt);
+    }
 }
 
 void
@@ -173,6 +173,13 @@ class CPU : public BaseCPU
     ProbePointArg<PacketPtr> *ppInstAccessComplete;
     ProbePointArg<std::pair<DynInstPtr, PacketPtr> > *ppDataAccessComplete;
 
+    /**
+     * Notified with the access of every committed load, so that
+     * listeners such as prefetchers can be trained on the non-speculative
+     * load stream. The packet is only built when there are listeners.
+     */
+    ProbePointArg<PacketPtr> *ppRetiredLoadAccess;
+
     /** Register probe points. */
     void regProbePoints() override;
 
@@ -187,6 +187,7 @@ class DynInst : public ExecContext, public RefCounted
         ReqMade,
         MemOpDone,
         HtmFromTransaction,
+        ValuePredicted,
         MaxFlags
     };
 
@@ -381,6 +382,10 @@ class DynInst : public ExecContext, public RefCounted
     bool notAnInst() const { return instFlags[NotAnInst]; }
     void setNotAnInst() { instFlags[NotAnInst] = true; }
 
+    /** Whether dependents were woken with a predicted value. */
+    bool isValuePredicted() const { return instFlags[ValuePredicted]; }
+    void setValuePredicted() { instFlags[ValuePredicted] = true; }
+
 
     ////////////////////////////////////////////
     //
@@ -99,7 +99,11 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
       numThreads(params.numThreads),
       numFetchingThreads(params.smtNumFetchingThreads),
       icachePort(this, _cpu),
-      finishTranslationEvent(this), fetchStats(_cpu, this)
+      finishTranslationEvent(this),
+      fetchTargetQueueSize(params.fetchTargetQueueSize),
+      fetchTargetPrefetchWidth(params.fetchTargetPrefetchWidth),
+      outstandingPrefetches(0),
+      fetchStats(_cpu, this)
 {
     if (numThreads > MaxThreads)
         fatal("numThreads (%d) is larger than compiled limit (%d),\n"
@@ -130,6 +134,8 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
         fetchBufferValid[i] = false;
         lastIcacheStall[i] = 0;
         issuePipelinedIfetch[i] = false;
+        nextFetchTarget[i] = 0;
+        lastTargetPrefetch[i] = MaxAddr;
     }
 
     branchPred = params.branchPred;
@@ -194,7 +200,20 @@ Fetch::FetchStatGroup::FetchStatGroup(CPU *cpu, Fetch *fetch)
              "Number of instructions fetched each cycle (Total)"),
     ADD_STAT(idleRate, statistics::units::Ratio::get(),
              "Ratio of cycles fetch was idle",
-             idleCycles / cpu->baseStats.numCycles)
+             idleCycles / cpu->baseStats.numCycles),
+    ADD_STAT(ftqOccupancy, statistics::units::Count::get(),
+             "Number of fetch targets queued each cycle"),
+    ADD_STAT(ftqResets, statistics::units::Count::get(),
+             "Number of times the fetch target queue was restarted"),
+    ADD_STAT(ftqPrefetches, statistics::units::Count::get(),
+             "Number of fetch-directed I-cache prefetches issued"),
+    ADD_STAT(ftqUsefulPrefetches, statistics::units::Count::get(),
+             "Number of prefetched fetch targets that were fetched"),
+    ADD_STAT(ftqUselessPrefetches, statistics::units::Count::get(),
+             "Number of prefetched fetch targets discarded before fetch"),
+    ADD_STAT(ftqPrefetchAccuracy, statistics::units::Ratio::get(),
+             "Fraction of fetch-directed prefetches that were fetched",
+             ftqUsefulPrefetches / ftqPrefetches)
 {
         predictedBranches
             .prereq(predictedBranches);
@@ -233,6 +252,21 @@ Fetch::FetchStatGroup::FetchStatGroup(CPU *cpu, Fetch *fetch)
             .flags(statistics::pdf);
         idleRate
             .prereq(idleRate);
+        ftqOccupancy
+            .init(/* base value */ 0,
+              /* last value */ fetch->fetchTargetQueueSize,
+              /* bucket size */ 1)
+            .flags(statistics::pdf);
+        ftqResets
+            .prereq(ftqResets);
+        ftqPrefetches
+            .prereq(ftqPrefetches);
+        ftqUsefulPrefetches
+            .prereq(ftqUsefulPrefetches);
+        ftqUselessPrefetches
+            .prereq(ftqUselessPrefetches);
+        ftqPrefetchAccuracy
+            .prereq(ftqPrefetches);
 }
 void
 Fetch::setTimeBuffer(TimeBuffer<TimeStruct> *time_buffer)
@@ -284,6 +318,7 @@ Fetch::clearStates(ThreadID tid)
     fetchBufferPC[tid] = 0;
     fetchBufferValid[tid] = false;
     fetchQueue[tid].clear();
+    resetFetchTargets(tid, pc[tid]->instAddr());
 
     // TODO not sure what to do with priorityList for now
     // priorityList.push_back(tid);
@@ -315,6 +350,7 @@ Fetch::resetStage()
         fetchBufferValid[tid] = false;
 
         fetchQueue[tid].clear();
+        resetFetchTargets(tid, pc[tid]->instAddr());
 
         priorityList.push_back(tid);
     }
@@ -388,6 +424,7 @@ Fetch::drainSanityCheck() const
         assert(!memReq[i]);
         assert(fetchStatus[i] == Idle || stalls[i].drain);
     }
+    assert(outstandingPrefetches == 0);
 
     branchPred->drainSanityCheck();
 }
@@ -415,6 +452,10 @@ Fetch::isDrained() const
         }
     }
 
+    /* Instruction prefetches must have been answered by the cache. */
+    if (outstandingPrefetches != 0)
+        return false;
+
     /* The pipeline might start up again in the middle of the drain
      * cycle if the finish translation event is scheduled, so make
      * sure that's not the case.
@@ -555,6 +596,10 @@ Fetch::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
     DPRINTF(Fetch, "[tid:%i] Fetching cache line %#x for addr %#x\n",
             tid, fetchBufferBlockPC, vaddr);
 
+    if (fetchTargetQueueSize) {
+        consumeFetchTarget(tid, vaddr);
+    }
+
     // Setup the memReq to do a read of the first instruction's address.
     // Set the appropriate read size and flags as well.
     // Build request here.
@@ -723,6 +768,9 @@ Fetch::doSquash(const PCStateBase &new_pc, const DynInstPtr squashInst,
     // Empty fetch queue
     fetchQueue[tid].clear();
 
+    // Restart the run-ahead branch prediction at the corrected PC
+    resetFetchTargets(tid, new_pc.instAddr());
+
     // microops are being squashed, it is not known wheather the
     // youngest non-squashed microop was  marked delayed commit
     // or not. Setting the flag to true ensures that the
@@ -866,6 +914,13 @@ Fetch::tick()
         }
     }
 
+    // Let the BTB run ahead of fetch and prefetch the predicted blocks.
+    if (fetchTargetQueueSize) {
+        for (auto tid : *activeThreads) {
+            advanceFetchTargets(tid);
+        }
+    }
+
     // Send instructions enqueued into the fetch queue to decode.
     // Limit rate by fetchWidth.  Stall if decode is stalled.
     unsigned insts_to_decode = 0;
@@ -1329,6 +1384,168 @@ Fetch::fetch(bool &status_change)
         !curMacroop;
 }
 
+void
+Fetch::advanceFetchTargets(ThreadID tid)
+{
+    fetchStats.ftqOccupancy.sample(fetchTargets[tid].size());
+
+    // The run-ahead keeps going while fetch waits on the I-cache or ITLB,
+    // but not while the thread is being redirected or is stalled.
+    switch (fetchStatus[tid]) {
+      case Running:
+      case ItlbWait:
+      case IcacheWaitResponse:
+      case IcacheWaitRetry:
+      case IcacheAccessComplete:
+        break;
+      default:
+        return;
+    }
+
+    if (fetchTargets[tid].size() < fetchTargetQueueSize) {
+        Addr target_pc = nextFetchTarget[tid];
+        fetchTargets[tid].push_back({target_pc, false});
+        nextFetchTarget[tid] = predictNextFetchTarget(tid, target_pc);
+
+        DPRINTF(Fetch, "[tid:%i] Queued fetch target %#x, next target "
+                "%#x.\n", tid, target_pc, nextFetchTarget[tid]);
+    }
+
+    issueTargetPrefetches(tid);
+}
+
+Addr
+Fetch::predictNextFetchTarget(ThreadID tid, Addr start_pc)
+{
+    const Addr block_end = fetchBufferAlignPC(start_pc) + fetchBufferSize;
+    for (Addr inst_pc = start_pc; inst_pc < block_end; inst_pc += instSize) {
+        const PCStateBase *target = branchPred->BTBLookup(tid, inst_pc);
+        if (target) {
+            return target->instAddr();
+        }
+    }
+    return block_end;
+}
+
+void
+Fetch::issueTargetPrefetches(ThreadID tid)
+{
+    unsigned issued = 0;
+    for (auto &target : fetchTargets[tid]) {
+        if (issued >= fetchTargetPrefetchWidth || cacheBlocked) {
+            break;
+        }
+        if (target.prefetched) {
+            continue;
+        }
+
+        const Addr blk_addr = target.pc & ~Addr(cacheBlkSize - 1);
+        if (blk_addr == lastTargetPrefetch[tid]) {
+            // The line was already requested for an earlier target.
+            continue;
+        }
+
+        // Prefetches are translated functionally; this models an ITLB
+        // that is also filled by the run-ahead front end.
+        RequestPtr pf_req = std::make_shared<Request>(
+            blk_addr, cacheBlkSize,
+            Request::INST_FETCH | Request::PREFETCH,
+            cpu->instRequestorId(), target.pc,
+            cpu->thread[tid]->contextId());
+        pf_req->taskId(cpu->taskId());
+
+        Fault fault = cpu->mmu->translateFunctional(
+            pf_req, cpu->thread[tid]->getTC(), BaseMMU::Execute);
+        if (fault != NoFault || pf_req->isUncacheable() ||
+            !cpu->system->isMemAddr(pf_req->getPaddr())) {
+            DPRINTF(Fetch, "[tid:%i] Not prefetching fetch target %#x.\n",
+                    tid, target.pc);
+            target.prefetched = true;
+            continue;
+        }
+
+        PacketPtr pf_pkt = new Packet(pf_req, MemCmd::SoftPFReq);
+        pf_pkt->dataDynamic(new uint8_t[cacheBlkSize]);
+
+        if (!icachePort.sendTimingReq(pf_pkt)) {
+            // Hold off demand fetches until the cache asks for a retry,
+            // the target is tried again afterwards.
+            DPRINTF(Fetch, "[tid:%i] Prefetch of %#x blocked.\n",
+                    tid, blk_addr);
+            delete pf_pkt;
+            cacheBlocked = true;
+            break;
+        }
+
+        DPRINTF(Fetch, "[tid:%i] Prefetching fetch target %#x (line "
+                "%#x).\n", tid, target.pc, blk_addr);
+        target.prefetched = true;
+        lastTargetPrefetch[tid] = blk_addr;
+        ++outstandingPrefetches;
+        ++fetchStats.ftqPrefetches;
+        ++issued;
+    }
+}
+
+void
+Fetch::consumeFetchTarget(ThreadID tid, Addr fetch_pc)
+{
+    const Addr fetch_block = fetchBufferAlignPC(fetch_pc);
+    auto &targets = fetchTargets[tid];
+
+    auto it = std::find_if(targets.begin(), targets.end(),
+        [this, fetch_block](const FetchTarget &target)
+        {
+            return fetchBufferAlignPC(target.pc) == fetch_block;
+        });
+
+    if (it == targets.end()) {
+        DPRINTF(Fetch, "[tid:%i] Fetch target queue missed %#x, "
+                "restarting.\n", tid, fetch_pc);
+        resetFetchTargets(tid, fetch_pc);
+        // Fetch is reading this block itself, run ahead from the next one
+        nextFetchTarget[tid] = predictNextFetchTarget(tid, fetch_pc);
+        return;
+    }
+
+    // Targets skipped over were never fetched.
+    for (auto skipped = targets.begin(); skipped != it; ++skipped) {
+        if (skipped->prefetched) {
+            ++fetchStats.ftqUselessPrefetches;
+        }
+    }
+    if (it->prefetched) {
+        ++fetchStats.ftqUsefulPrefetches;
+    }
+    targets.erase(targets.begin(), std::next(it));
+}
+
+void
+Fetch::resetFetchTargets(ThreadID tid, Addr restart_pc)
+{
+    for (const auto &target : fetchTargets[tid]) {
+        if (target.prefetched) {
+            ++fetchStats.ftqUselessPrefetches;
+        }
+    }
+    if (!fetchTargets[tid].empty()) {
+        ++fetchStats.ftqResets;
+    }
+    fetchTargets[tid].clear();
+    nextFetchTarget[tid] = restart_pc;
+    lastTargetPrefetch[tid] = MaxAddr;
+}
+
+void
+Fetch::processPrefetchCompletion(PacketPtr pkt)
+{
+    DPRINTF(Fetch, "Instruction prefetch of %#x completed.\n",
+            pkt->getAddr());
+    assert(outstandingPrefetches > 0);
+    --outstandingPrefetches;
+    delete pkt;
+}
+
 void
 Fetch::recvReqRetry()
 {
@@ -1586,7 +1803,11 @@ Fetch::IcachePort::recvTimingResp(PacketPtr pkt)
     // We shouldn't ever get a cacheable block in Modified state
     assert(pkt->req->isUncacheable() ||
            !(pkt->cacheResponding() && !pkt->hasSharers()));
-    fetch->processCacheCompletion(pkt);
+    if (pkt->cmd == MemCmd::SoftPFResp) {
+        fetch->processPrefetchCompletion(pkt);
+    } else {
+        fetch->processCacheCompletion(pkt);
+    }
 
     return true;
 }
@@ -323,6 +323,40 @@ class Fetch
      * cycle. */
     FetchStatus updateFetchStatus();
 
+    /**
+     * Runs the BTB one fetch block ahead of fetch, appending the
+     * predicted block to the fetch target queue, and issues
+     * fetch-directed prefetches for the queued targets.
+     * @param tid Thread to advance the fetch target queue for.
+     */
+    void advanceFetchTargets(ThreadID tid);
+
+    /**
+     * Predicts where fetch goes after the fetch block starting at the
+     * given address, using only the BTB: the first BTB hit in the block
+     * is assumed to be a taken branch.
+     * @param tid The thread id.
+     * @param start_pc Address fetch enters the block at.
+     * @return The address fetch continues from.
+     */
+    Addr predictNextFetchTarget(ThreadID tid, Addr start_pc);
+
+    /** Issues I-cache prefetches for queued fetch targets. */
+    void issueTargetPrefetches(ThreadID tid);
+
+    /**
+     * Retires fetch targets up to the block fetch is about to read. If
+     * the block is not in the queue the run-ahead went astray and the
+     * queue is restarted from the demand address.
+     */
+    void consumeFetchTarget(ThreadID tid, Addr fetch_pc);
+
+    /** Empties the fetch target queue and restarts it at a new PC. */
+    void resetFetchTargets(ThreadID tid, Addr restart_pc);
+
+    /** Handles the response to an instruction prefetch. */
+    void processPrefetchCompletion(PacketPtr pkt);
+
   public:
     /** Squashes a specific thread and resets the PC. Also tells the CPU to
      * remove any instructions that are not in the ROB. The source of this
@@ -527,6 +561,33 @@ class Fetch
     /** Event used to delay fault generation of translation faults */
     FinishTranslationEvent finishTranslationEvent;
 
+    /** A fetch block predicted by the run-ahead BTB walk. */
+    struct FetchTarget
+    {
+        /** Address fetch enters the block at. */
+        Addr pc;
+        /** Whether a prefetch was sent for the block's cache line. */
+        bool prefetched;
+    };
+
+    /** Maximum number of entries in each fetch target queue. */
+    const unsigned fetchTargetQueueSize;
+
+    /** Maximum number of target prefetches issued per cycle. */
+    const unsigned fetchTargetPrefetchWidth;
+
+    /** Fetch target queues, filled ahead of fetch by the BTB. */
+    std::deque<FetchTarget> fetchTargets[MaxThreads];
+
+    /** Address the run-ahead BTB walk continues from. */
+    Addr nextFetchTarget[MaxThreads];
+
+    /** Cache line most recently prefetched for each thread. */
+    Addr lastTargetPrefetch[MaxThreads];
+
+    /** Number of instruction prefetches awaiting their response. */
+    unsigned outstandingPrefetches;
+
   protected:
     struct FetchStatGroup : public statistics::Group
     {
@@ -575,6 +636,18 @@ class Fetch
         statistics::Distribution nisnDist;
         /** Rate of how often fetch was idle. */
         statistics::Formula idleRate;
+        /** Distribution of the fetch target queue occupancy. */
+        statistics::Distribution ftqOccupancy;
+        /** Number of times the fetch target queue was restarted. */
+        statistics::Scalar ftqResets;
+        /** Number of fetch-directed prefetches sent to the I-cache. */
+        statistics::Scalar ftqPrefetches;
+        /** Number of prefetched fetch targets later fetched. */
+        statistics::Scalar ftqUsefulPrefetches;
+        /** Number of prefetched fetch targets discarded unused. */
+        statistics::Scalar ftqUselessPrefetches;
+        /** Fraction of fetch-directed prefetches that were used. */
+        statistics::Formula ftqPrefetchAccuracy;
     } fetchStats;
 };
 
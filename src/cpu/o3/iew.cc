@@ -70,6 +70,7 @@ IEW::IEW(CPU *_cpu, const BaseO3CPUParams &params)
       instQueue(_cpu, this, params),
       ldstQueue(_cpu, this, params),
       fuPool(params.fuPool),
+      valuePred(params.valuePred),
       commitToIEWDelay(params.commitToIEWDelay),
       renameToIEWDelay(params.renameToIEWDelay),
       issueToExecuteDelay(params.issueToExecuteDelay),
@@ -167,6 +168,10 @@ IEW::IEWStats::IEWStats(CPU *cpu)
              "Number of times the LSQ has become full, causing a stall"),
     ADD_STAT(memOrderViolationEvents, statistics::units::Count::get(),
              "Number of memory order violations"),
+    ADD_STAT(valuePredictedLoads, statistics::units::Count::get(),
+             "Number of loads dispatched with a predicted value"),
+    ADD_STAT(valueMispredictEvents, statistics::units::Count::get(),
+             "Number of value mispredictions that caused a squash"),
     ADD_STAT(predictedTakenIncorrect, statistics::units::Count::get(),
              "Number of branches that were predicted taken incorrectly"),
     ADD_STAT(predictedNotTakenIncorrect, statistics::units::Count::get(),
@@ -347,6 +352,8 @@ IEW::drainSanityCheck() const
 
     instQueue.drainSanityCheck();
     ldstQueue.drainSanityCheck();
+    if (valuePred)
+        valuePred->drainSanityCheck();
 }
 
 void
@@ -388,6 +395,17 @@ IEW::squash(ThreadID tid)
     ldstQueue.squash(fromCommit->commitInfo[tid].doneSeqNum, tid);
     updatedQueues = true;
 
+    // Roll back the value predictor history, and correct the direction
+    // of the branch if it was mispredicted.
+    if (valuePred) {
+        const auto &info = fromCommit->commitInfo[tid];
+        if (info.mispredictInst && info.mispredictInst->isControl()) {
+            valuePred->squash(info.doneSeqNum, info.branchTaken, tid);
+        } else {
+            valuePred->squash(info.doneSeqNum, tid);
+        }
+    }
+
     // Clear the skid buffer in case it has any data in it.
     DPRINTF(IEW,
             "Removing skidbuffer instructions until "
@@ -461,6 +479,60 @@ IEW::squashDueToMemOrder(const DynInstPtr& inst, ThreadID tid)
     }
 }
 
+void
+IEW::squashDueToValueMispredict(const DynInstPtr& inst, ThreadID tid)
+{
+    DPRINTF(IEW, "[tid:%i] Value mispredict, squashing insts younger than "
+            "PC: %s [sn:%llu].\n", tid, inst->pcState(), inst->seqNum);
+
+    // The load itself holds the correct value, so only the younger
+    // instructions are squashed and fetch restarts right after it.
+    if (!toCommit->squash[tid] ||
+            inst->seqNum < toCommit->squashedSeqNum[tid]) {
+        toCommit->squash[tid] = true;
+        toCommit->squashedSeqNum[tid] = inst->seqNum;
+        toCommit->branchTaken[tid] = false;
+
+        set(toCommit->pc[tid], inst->pcState());
+        inst->staticInst->advancePC(*toCommit->pc[tid]);
+
+        toCommit->mispredictInst[tid] = NULL;
+        toCommit->includeSquashInst[tid] = false;
+
+        wroteToTimeBuffer = true;
+    }
+}
+
+void
+IEW::predictValue(const DynInstPtr& inst, ThreadID tid)
+{
+    // Only loads writing a single renamed integer register are predicted.
+    if (inst->numDestRegs() != 1)
+        return;
+
+    PhysRegIdPtr dest_reg = inst->renamedDestIdx(0);
+    if (!dest_reg->is(IntRegClass) || dest_reg->isFixedMapping() ||
+            dest_reg->isPinned()) {
+        return;
+    }
+
+    RegVal value;
+    if (!valuePred->predict(inst->seqNum, inst->pcState().instAddr(), tid,
+                            value)) {
+        return;
+    }
+
+    DPRINTF(IEW, "[tid:%i] [sn:%llu] Predicted value %#x for PC %s.\n",
+            tid, inst->seqNum, value, inst->pcState());
+
+    cpu->setReg(dest_reg, value, tid);
+    inst->setValuePredicted();
+    instQueue.wakeValuePredictedDependents(inst);
+    scoreboard->setReg(dest_reg);
+
+    ++iewStats.valuePredictedLoads;
+}
+
 void
 IEW::block(ThreadID tid)
 {
@@ -1042,6 +1114,15 @@ IEW::dispatchInsts(ThreadID tid)
         // instruction.
         if (add_to_iq) {
             instQueue.insert(inst);
+
+            if (valuePred && inst->isLoad() && !inst->isAtomic())
+                predictValue(inst, tid);
+        }
+
+        if (valuePred && inst->isControl()) {
+            valuePred->dispatchBranch(inst->seqNum,
+                                      inst->pcState().instAddr(),
+                                      inst->readPredTaken(), tid);
         }
 
         insts_to_dispatch.pop();
@@ -1367,6 +1448,19 @@ IEW::writebackInsts()
         // when it's ready to execute the strictly ordered load.
         if (!inst->isSquashed() && inst->isExecuted() &&
                 inst->getFault() == NoFault) {
+            // Check the loaded value against the predicted one. If the
+            // dependents consumed a wrong value, they must be squashed.
+            // Only the loads that were looked up, which all write an
+            // integer register, have their destination read.
+            if (valuePred && inst->isLoad() &&
+                    valuePred->needsVerify(inst->seqNum, tid) &&
+                    valuePred->verify(inst->seqNum,
+                        cpu->getReg(inst->renamedDestIdx(0), tid), tid)) {
+                assert(inst->isValuePredicted());
+                squashDueToValueMispredict(inst, tid);
+                ++iewStats.valueMispredictEvents;
+            }
+
             int dependents = instQueue.wakeDependents(inst);
 
             for (int i = 0; i < inst->numDestRegs(); i++) {
@@ -1467,6 +1561,9 @@ IEW::tick()
 
             updateLSQNextCycle = true;
             instQueue.commit(fromCommit->commitInfo[tid].doneSeqNum,tid);
+
+            if (valuePred)
+                valuePred->update(fromCommit->commitInfo[tid].doneSeqNum, tid);
         }
 
         if (fromCommit->commitInfo[tid].nonSpecSeqNum != 0) {
@@ -51,6 +51,7 @@
 #include "cpu/o3/limits.hh"
 #include "cpu/o3/lsq.hh"
 #include "cpu/o3/scoreboard.hh"
+#include "cpu/pred/vpred_unit.hh"
 #include "cpu/timebuf.hh"
 #include "debug/IEW.hh"
 #include "sim/probe/probe.hh"
@@ -247,6 +248,18 @@ class IEW
      */
     void squashDueToMemOrder(const DynInstPtr &inst, ThreadID tid);
 
+    /** Sends commit proper information for a squash due to a load whose
+     * dependents consumed a mispredicted value. The load itself is not
+     * squashed.
+     */
+    void squashDueToValueMispredict(const DynInstPtr &inst, ThreadID tid);
+
+    /** Looks up a value for a load being dispatched, and if the predictor
+     * is confident, writes it to the load's destination register and
+     * wakes the load's dependents.
+     */
+    void predictValue(const DynInstPtr &inst, ThreadID tid);
+
     /** Sets Dispatch to blocked, and signals back to other stages to block. */
     void block(ThreadID tid);
 
@@ -359,6 +372,9 @@ class IEW
 
     /** Pointer to the functional unit pool. */
     FUPool *fuPool;
+
+    /** Load value predictor, NULL if value prediction is disabled. */
+    value_prediction::VPredUnit *valuePred;
     /** Records if the LSQ needs to be updated on the next cycle, so that
      * IEW knows if there will be activity on the next cycle.
      */
@@ -443,6 +459,12 @@ class IEW
         statistics::Scalar lsqFullEvents;
         /** Stat for total number of memory ordering violation events. */
         statistics::Scalar memOrderViolationEvents;
+        /** Stat for total number of loads that were dispatched with a
+         *  predicted value. */
+        statistics::Scalar valuePredictedLoads;
+        /** Stat for total number of value mispredictions that caused a
+         *  squash. */
+        statistics::Scalar valueMispredictEvents;
         /** Stat for total number of incorrect predicted taken branches. */
         statistics::Scalar predictedTakenIncorrect;
         /** Stat for total number of incorrect predicted not taken branches. */
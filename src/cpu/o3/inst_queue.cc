@@ -1027,39 +1027,69 @@ InstructionQueue::wakeDependents(const DynInstPtr &completed_inst)
             continue;
         }
 
-        DPRINTF(IQ, "Waking any dependents on register %i (%s).\n",
-                dest_reg->index(),
-                dest_reg->className());
+        dependents += wakeRegDependents(dest_reg);
+    }
+    return dependents;
+}
+
+int
+InstructionQueue::wakeRegDependents(PhysRegIdPtr dest_reg)
+{
+    int dependents = 0;
 
-        //Go through the dependency chain, marking the registers as
-        //ready within the waiting instructions.
-        DynInstPtr dep_inst = dependGraph.pop(dest_reg->flatIndex());
+    DPRINTF(IQ, "Waking any dependents on register %i (%s).\n",
+            dest_reg->index(),
+            dest_reg->className());
 
-        while (dep_inst) {
-            DPRINTF(IQ, "Waking up a dependent instruction, [sn:%llu] "
-                    "PC %s.\n", dep_inst->seqNum, dep_inst->pcState());
+    //Go through the dependency chain, marking the registers as
+    //ready within the waiting instructions.
+    DynInstPtr dep_inst = dependGraph.pop(dest_reg->flatIndex());
 
-            // Might want to give more information to the instruction
-            // so that it knows which of its source registers is
-            // ready.  However that would mean that the dependency
-            // graph entries would need to hold the src_reg_idx.
-            dep_inst->markSrcRegReady();
+    while (dep_inst) {
+        DPRINTF(IQ, "Waking up a dependent instruction, [sn:%llu] "
+                "PC %s.\n", dep_inst->seqNum, dep_inst->pcState());
 
-            addIfReady(dep_inst);
+        // Might want to give more information to the instruction
+        // so that it knows which of its source registers is
+        // ready.  However that would mean that the dependency
+        // graph entries would need to hold the src_reg_idx.
+        dep_inst->markSrcRegReady();
 
-            dep_inst = dependGraph.pop(dest_reg->flatIndex());
+        addIfReady(dep_inst);
 
-            ++dependents;
-        }
+        dep_inst = dependGraph.pop(dest_reg->flatIndex());
+
+        ++dependents;
+    }
 
-        // Reset the head node now that all of its dependents have
-        // been woken up.
-        assert(dependGraph.empty(dest_reg->flatIndex()));
-        dependGraph.clearInst(dest_reg->flatIndex());
+    // Reset the head node now that all of its dependents have
+    // been woken up.
+    assert(dependGraph.empty(dest_reg->flatIndex()));
+    dependGraph.clearInst(dest_reg->flatIndex());
 
-        // Mark the scoreboard as having that register ready.
-        regScoreboard[dest_reg->flatIndex()] = true;
+    // Mark the scoreboard as having that register ready.
+    regScoreboard[dest_reg->flatIndex()] = true;
+
+    return dependents;
+}
+
+int
+InstructionQueue::wakeValuePredictedDependents(const DynInstPtr &inst)
+{
+    assert(inst->isValuePredicted());
+    assert(!inst->isSquashed());
+
+    int dependents = 0;
+    for (int dest_reg_idx = 0; dest_reg_idx < inst->numDestRegs();
+         dest_reg_idx++) {
+        PhysRegIdPtr dest_reg = inst->renamedDestIdx(dest_reg_idx);
+        assert(!dest_reg->isFixedMapping() && !dest_reg->isPinned());
+        dependents += wakeRegDependents(dest_reg);
     }
+
+    DPRINTF(IQ, "Woke %i dependents of value predicted [sn:%llu].\n",
+            dependents, inst->seqNum);
+
     return dependents;
 }
 
@@ -0,0 +1,80 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.SimObject import SimObject
+from m5.params import *
+from m5.proxy import *
+
+
+class ValuePredictor(SimObject):
+    type = "ValuePredictor"
+    cxx_class = "gem5::value_prediction::VPredUnit"
+    cxx_header = "cpu/pred/vpred_unit.hh"
+    abstract = True
+
+    numThreads = Param.Unsigned(Parent.numThreads, "Number of threads")
+    instShiftAmt = Param.Unsigned(2, "Number of bits to shift instructions by")
+    confidenceBits = Param.Unsigned(3, "Number of bits of confidence counters")
+    confidenceThreshold = Param.Unsigned(
+        7, "Confidence needed for a predicted value to be used"
+    )
+
+
+class LastValuePredictor(ValuePredictor):
+    type = "LastValuePredictor"
+    cxx_class = "gem5::value_prediction::LastValuePredictor"
+    cxx_header = "cpu/pred/last_value_pred.hh"
+
+    tableSize = Param.Unsigned(1024, "Number of entries of the value table")
+    tagBits = Param.Unsigned(16, "Number of bits of the partial PC tags")
+
+
+class StrideValuePredictor(ValuePredictor):
+    type = "StrideValuePredictor"
+    cxx_class = "gem5::value_prediction::StrideValuePredictor"
+    cxx_header = "cpu/pred/stride_value_pred.hh"
+
+    tableSize = Param.Unsigned(1024, "Number of entries of the stride table")
+    tagBits = Param.Unsigned(16, "Number of bits of the partial PC tags")
+
+
+class VTAGEValuePredictor(ValuePredictor):
+    type = "VTAGEValuePredictor"
+    cxx_class = "gem5::value_prediction::VTAGEValuePredictor"
+    cxx_header = "cpu/pred/vtage_value_pred.hh"
+
+    logBaseTableSize = Param.Unsigned(
+        10, "Log2 of the number of entries of the PC-indexed base table"
+    )
+    logTaggedTableSize = Param.Unsigned(
+        8, "Log2 of the number of entries of each tagged table"
+    )
+    historyLengths = VectorParam.Unsigned(
+        [2, 4, 8, 16, 32, 64],
+        "Global branch history length used by each tagged table",
+    )
+    tagBits = Param.Unsigned(12, "Number of bits of the tagged table tags")
+    usefulBits = Param.Unsigned(1, "Number of bits of the useful counters")
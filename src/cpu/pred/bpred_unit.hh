@@ -158,13 +158,14 @@ class BPredUnit : public SimObject
      * Looks up a given PC in the BTB to get the predicted target. The PC may
      * be changed or deleted in the future, so it needs to be used immediately,
      * and/or copied for use later.
+     * @param tid The thread id.
      * @param inst_PC The PC to look up.
      * @return The address of the target of the branch.
      */
     const PCStateBase *
-    BTBLookup(Addr inst_pc)
+    BTBLookup(ThreadID tid, Addr inst_pc)
     {
-        return BTB.lookup(inst_pc, 0);
+        return BTB.lookup(inst_pc, tid);
     }
 
     /**
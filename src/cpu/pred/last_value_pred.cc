@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/last_value_pred.hh"
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+LastValuePredictor::LastValuePredictor(
+        const LastValuePredictorParams &params)
+    : VPredUnit(params),
+      tableSize(params.tableSize),
+      tagBits(params.tagBits),
+      indexBits(floorLog2(params.tableSize)),
+      table(params.tableSize, Entry(params.confidenceBits))
+{
+    fatal_if(!isPowerOf2(tableSize),
+             "%s: the value table size must be a power of 2\n", name());
+}
+
+unsigned
+LastValuePredictor::getIndex(Addr pc) const
+{
+    return pcIndex(pc) & (tableSize - 1);
+}
+
+Addr
+LastValuePredictor::getTag(Addr pc) const
+{
+    return (pcIndex(pc) >> indexBits) & mask(tagBits);
+}
+
+bool
+LastValuePredictor::lookup(ThreadID tid, Addr pc, RegVal &value,
+                           void * &vp_history)
+{
+    const Entry &entry = table[getIndex(pc)];
+    if (!entry.valid || entry.tag != getTag(pc)) {
+        value = 0;
+        return false;
+    }
+    value = entry.value;
+    return static_cast<unsigned>(entry.confidence) >= confidenceThreshold;
+}
+
+void
+LastValuePredictor::train(ThreadID tid, Addr pc, RegVal value,
+                          void *vp_history)
+{
+    Entry &entry = table[getIndex(pc)];
+    const Addr tag = getTag(pc);
+    if (entry.valid && entry.tag == tag && entry.value == value) {
+        entry.confidence++;
+        return;
+    }
+
+    // Either a new load or a new value: start learning it from scratch
+    entry.valid = true;
+    entry.tag = tag;
+    entry.value = value;
+    entry.confidence.reset();
+}
+
+} // namespace value_prediction
+} // namespace gem5
@@ -309,16 +309,19 @@ MultiperspectivePerceptron::getIndex(ThreadID tid, const MPPBranchInfo &bi,
 int
 MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
 {
+    ThreadData &td = *threadData[tid];
+    const int num_specs = specs.size();
+
     // list of best predictors
-    std::vector<int> best_preds(specs.size(), -1);
+    bestPreds.assign(num_specs, -1);
 
     // initialize sum
     bi.yout = 0;
 
     // bias the prediction by whether the local history is
     // one of four distinctive patterns
-    int lhist = threadData[tid]->localHistories[bi.getPC()];
-    int history_len = threadData[tid]->localHistories.getLocalHistoryLength();
+    int lhist = td.localHistories[bi.getPC()];
+    int history_len = td.localHistories.getLocalHistoryLength();
     if (lhist == 0) {
         bi.yout = bias0;
     } else if (lhist == ((1<<history_len)-1)) {
@@ -330,40 +333,48 @@ MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
     }
     // find the best subset of features to use in case of a low-confidence
     // branch
-    findBest(tid, best_preds);
-
-    // begin computation of the sum for low-confidence branch
-    int bestval = 0;
+    findBest(tid, bestPreds);
+
+    // flag the best features once, rather than searching the list of best
+    // predictors for every feature
+    isBestPred.assign(num_specs, 0);
+    if (threshold >= 0) {
+        for (int j = 0; j < std::min(nbest, num_specs); j += 1) {
+            if (bestPreds[j] >= 0) {
+                isBestPred[bestPreds[j]] = -1;
+            }
+        }
+    }
 
-    for (int i = 0; i < specs.size(); i += 1) {
+    // compute the signed, weighted output of every feature
+    featureValues.resize(num_specs);
+    const unsigned sign_idx = bi.getHPC() % n_sign_bits;
+    for (int i = 0; i < num_specs; i += 1) {
         HistorySpec const &spec = *specs[i];
         // get the hash to index the table
         unsigned int hashed_idx = getIndex(tid, bi, spec, i);
         // add the weight; first get the weight's magnitude
-        int counter = threadData[tid]->tables[i][hashed_idx];
+        int counter = td.tables[i][hashed_idx];
         // get the sign
-        bool sign =
-          threadData[tid]->sign_bits[i][hashed_idx][bi.getHPC() % n_sign_bits];
+        bool sign = td.sign_bits[i][hashed_idx][sign_idx];
         // apply the transfer function and multiply by a coefficient
         int weight = spec.coeff * ((spec.width == 5) ?
                                    xlat4[counter] : xlat[counter]);
         // apply the sign
-        int val = sign ? -weight : weight;
-        // add the value
-        bi.yout += val;
-        // if this is one of those good features, add the value to bestval
-        if (threshold >= 0) {
-            for (int j = 0;
-                 j < std::min(nbest, (int) best_preds.size());
-                 j += 1)
-            {
-                if (best_preds[j] == i) {
-                    bestval += val;
-                    break;
-                }
-            }
-        }
+        featureValues[i] = sign ? -weight : weight;
     }
+
+    // begin computation of the sum for low-confidence branch; the
+    // accumulation has no data-dependent branches so that the compiler can
+    // vectorize it
+    int sum = 0;
+    int bestval = 0;
+    for (int i = 0; i < num_specs; i += 1) {
+        sum += featureValues[i];
+        bestval += featureValues[i] & isBestPred[i];
+    }
+    bi.yout += sum;
+
     // apply a fudge factor to affect when training is triggered
     bi.yout *= fudge;
     return bestval;
@@ -378,6 +378,11 @@ class MultiperspectivePerceptron : public BPredUnit
     std::vector<int> modpath_indices;
     std::vector<int> modpath_lengths;
     std::vector<std::vector<int>> blurrypath_bits;
+
+    /** Scratch storage reused by computeOutput on every prediction */
+    std::vector<int> bestPreds;
+    std::vector<int> isBestPred;
+    std::vector<int> featureValues;
     std::vector<std::vector<std::vector<bool>>> acyclic_bits;
 
     /** Auxiliary function for MODHIST and GHISTMODPATH features */
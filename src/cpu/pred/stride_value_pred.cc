@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/stride_value_pred.hh"
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+StrideValuePredictor::StrideValuePredictor(
+        const StrideValuePredictorParams &params)
+    : VPredUnit(params),
+      tableSize(params.tableSize),
+      tagBits(params.tagBits),
+      indexBits(floorLog2(params.tableSize)),
+      table(params.tableSize, Entry(params.confidenceBits))
+{
+    fatal_if(!isPowerOf2(tableSize),
+             "%s: the stride table size must be a power of 2\n", name());
+}
+
+unsigned
+StrideValuePredictor::getIndex(Addr pc) const
+{
+    return pcIndex(pc) & (tableSize - 1);
+}
+
+Addr
+StrideValuePredictor::getTag(Addr pc) const
+{
+    return (pcIndex(pc) >> indexBits) & mask(tagBits);
+}
+
+bool
+StrideValuePredictor::lookup(ThreadID tid, Addr pc, RegVal &value,
+                             void * &vp_history)
+{
+    const unsigned index = getIndex(pc);
+    const Addr tag = getTag(pc);
+    Entry &entry = table[index];
+    if (!entry.valid || entry.tag != tag) {
+        value = 0;
+        return false;
+    }
+
+    // Skip the strides of the older instances that are still in flight
+    entry.inflight++;
+    value = entry.lastValue + entry.stride * entry.inflight;
+    vp_history = new StrideHistory{index, tag, true};
+
+    return static_cast<unsigned>(entry.confidence) >= confidenceThreshold;
+}
+
+void
+StrideValuePredictor::release(StrideHistory *history)
+{
+    if (!history || !history->inflight) {
+        return;
+    }
+    history->inflight = false;
+
+    Entry &entry = table[history->index];
+    if (entry.valid && entry.tag == history->tag && entry.inflight > 0) {
+        entry.inflight--;
+    }
+}
+
+void
+StrideValuePredictor::train(ThreadID tid, Addr pc, RegVal value,
+                            void *vp_history)
+{
+    release(static_cast<StrideHistory *>(vp_history));
+
+    Entry &entry = table[getIndex(pc)];
+    const Addr tag = getTag(pc);
+    if (!entry.valid || entry.tag != tag) {
+        entry.valid = true;
+        entry.tag = tag;
+        entry.lastValue = value;
+        entry.stride = 0;
+        entry.inflight = 0;
+        entry.confidence.reset();
+        return;
+    }
+
+    const RegVal stride = value - entry.lastValue;
+    if (stride == entry.stride) {
+        entry.confidence++;
+    } else {
+        entry.stride = stride;
+        entry.confidence.reset();
+    }
+    entry.lastValue = value;
+}
+
+void
+StrideValuePredictor::squash(ThreadID tid, void *vp_history)
+{
+    StrideHistory *history = static_cast<StrideHistory *>(vp_history);
+    release(history);
+    delete history;
+}
+
+void
+StrideValuePredictor::retire(ThreadID tid, void *vp_history)
+{
+    StrideHistory *history = static_cast<StrideHistory *>(vp_history);
+    release(history);
+    delete history;
+}
+
+} // namespace value_prediction
+} // namespace gem5
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Stride value predictor: predicts the value of a load as its last value
+ * plus the difference between its last two values. Loads of the same
+ * static instruction that are still in flight are accounted for, so that
+ * the n-th in-flight instance is predicted n strides ahead.
+ */
+
+#ifndef __CPU_PRED_STRIDE_VALUE_PRED_HH__
+#define __CPU_PRED_STRIDE_VALUE_PRED_HH__
+
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "cpu/pred/vpred_unit.hh"
+#include "params/StrideValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+class StrideValuePredictor : public VPredUnit
+{
+  public:
+    StrideValuePredictor(const StrideValuePredictorParams &params);
+
+  protected:
+    bool lookup(ThreadID tid, Addr pc, RegVal &value,
+                void * &vp_history) override;
+    void train(ThreadID tid, Addr pc, RegVal value,
+               void *vp_history) override;
+    void squash(ThreadID tid, void *vp_history) override;
+    void retire(ThreadID tid, void *vp_history) override;
+
+    struct Entry
+    {
+        Entry(unsigned conf_bits) : tag(0), valid(false), lastValue(0),
+                                    stride(0), inflight(0),
+                                    confidence(conf_bits)
+        {}
+
+        Addr tag;
+        bool valid;
+        RegVal lastValue;
+        RegVal stride;
+        /** Number of looked up instances that are not yet committed. */
+        unsigned inflight;
+        SatCounter8 confidence;
+    };
+
+    /** History of a lookup that hit in the table. */
+    struct StrideHistory
+    {
+        unsigned index;
+        Addr tag;
+        /** Whether the lookup is still counted as in flight. */
+        bool inflight;
+    };
+
+    /** Stops counting a lookup as in flight. */
+    void release(StrideHistory *history);
+
+    /** Returns the table index of a PC. */
+    unsigned getIndex(Addr pc) const;
+
+    /** Returns the partial tag of a PC. */
+    Addr getTag(Addr pc) const;
+
+    const unsigned tableSize;
+    const unsigned tagBits;
+    const unsigned indexBits;
+
+    std::vector<Entry> table;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_STRIDE_VALUE_PRED_HH__
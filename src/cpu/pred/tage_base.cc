@@ -37,6 +37,8 @@
 
 #include "cpu/pred/tage_base.hh"
 
+#include <algorithm>
+
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "debug/Fetch.hh"
@@ -144,6 +146,17 @@ TAGEBase::init()
 
     tableIndices = new int [nHistoryTables+1];
     tableTags = new int [nHistoryTables+1];
+
+    indexMasks.resize(nHistoryTables + 1, 0);
+    tagMasks.resize(nHistoryTables + 1, 0);
+    pcShifts.resize(nHistoryTables + 1, 0);
+    pathHistLengths.resize(nHistoryTables + 1, 0);
+    for (int i = 1; i <= nHistoryTables; i++) {
+        indexMasks[i] = (1ULL << logTagTableSizes[i]) - 1;
+        tagMasks[i] = (1ULL << tagTableTagWidths[i]) - 1;
+        pcShifts[i] = abs(logTagTableSizes[i] - i) + 1;
+        pathHistLengths[i] = std::min<int>(histLengths[i], pathHistBits);
+    }
     initialized = true;
 }
 
@@ -213,15 +226,15 @@ int
 TAGEBase::F(int A, int size, int bank) const
 {
     int A1, A2;
+    const int log_size = logTagTableSizes[bank];
+    const unsigned mask = indexMasks[bank];
 
     A = A & ((1ULL << size) - 1);
-    A1 = (A & ((1ULL << logTagTableSizes[bank]) - 1));
-    A2 = (A >> logTagTableSizes[bank]);
-    A2 = ((A2 << bank) & ((1ULL << logTagTableSizes[bank]) - 1))
-       + (A2 >> (logTagTableSizes[bank] - bank));
+    A1 = (A & mask);
+    A2 = (A >> log_size);
+    A2 = ((A2 << bank) & mask) + (A2 >> (log_size - bank));
     A = A1 ^ A2;
-    A = ((A << bank) & ((1ULL << logTagTableSizes[bank]) - 1))
-      + (A >> (logTagTableSizes[bank] - bank));
+    A = ((A << bank) & mask) + (A >> (log_size - bank));
     return (A);
 }
 
@@ -230,16 +243,15 @@ int
 TAGEBase::gindex(ThreadID tid, Addr pc, int bank) const
 {
     int index;
-    int hlen = (histLengths[bank] > pathHistBits) ? pathHistBits :
-                                                    histLengths[bank];
+    const ThreadHistory &tHist = threadHistory[tid];
     const unsigned int shiftedPc = pc >> instShiftAmt;
     index =
         shiftedPc ^
-        (shiftedPc >> ((int) abs(logTagTableSizes[bank] - bank) + 1)) ^
-        threadHistory[tid].computeIndices[bank].comp ^
-        F(threadHistory[tid].pathHist, hlen, bank);
+        (shiftedPc >> pcShifts[bank]) ^
+        tHist.computeIndices[bank].comp ^
+        F(tHist.pathHist, pathHistLengths[bank], bank);
 
-    return (index & ((1ULL << (logTagTableSizes[bank])) - 1));
+    return (index & indexMasks[bank]);
 }
 
 
@@ -247,11 +259,12 @@ TAGEBase::gindex(ThreadID tid, Addr pc, int bank) const
 uint16_t
 TAGEBase::gtag(ThreadID tid, Addr pc, int bank) const
 {
+    const ThreadHistory &tHist = threadHistory[tid];
     int tag = (pc >> instShiftAmt) ^
-              threadHistory[tid].computeTags[0][bank].comp ^
-              (threadHistory[tid].computeTags[1][bank].comp << 1);
+              tHist.computeTags[0][bank].comp ^
+              (tHist.computeTags[1][bank].comp << 1);
 
-    return (tag & ((1ULL << tagTableTagWidths[bank]) - 1));
+    return (tag & tagMasks[bank]);
 }
 
 
@@ -372,22 +385,19 @@ TAGEBase::tagePredict(ThreadID tid, Addr branch_pc,
 
         bi->hitBank = 0;
         bi->altBank = 0;
-        //Look for the bank with longest matching history
+        //Look for the bank with longest matching history and the
+        //alternate bank in a single pass over the tagged tables
         for (int i = nHistoryTables; i > 0; i--) {
             if (noSkip[i] &&
                 gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->hitBank = i;
-                bi->hitBankIndex = tableIndices[bi->hitBank];
-                break;
-            }
-        }
-        //Look for the alternate bank
-        for (int i = bi->hitBank - 1; i > 0; i--) {
-            if (noSkip[i] &&
-                gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->altBank = i;
-                bi->altBankIndex = tableIndices[bi->altBank];
-                break;
+                if (bi->hitBank == 0) {
+                    bi->hitBank = i;
+                    bi->hitBankIndex = tableIndices[i];
+                } else {
+                    bi->altBank = i;
+                    bi->altBankIndex = tableIndices[i];
+                    break;
+                }
             }
         }
         //computes the prediction and the alternate prediction
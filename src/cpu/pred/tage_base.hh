@@ -472,6 +472,13 @@ class TAGEBase : public SimObject
     int *tableIndices;
     int *tableTags;
 
+    // Per-bank constants used by the index and tag hashes, computed once
+    // in init() so that the per-branch hashing only does xors and ands
+    std::vector<unsigned> indexMasks;
+    std::vector<unsigned> tagMasks;
+    std::vector<int> pcShifts;
+    std::vector<int> pathHistLengths;
+
     std::vector<int8_t> useAltPredForNewlyAllocated;
     int64_t tCounter;
     uint64_t logUResetPeriod;
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/vpred_unit.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "debug/ValuePred.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+VPredUnit::VPredUnit(const Params &params)
+    : SimObject(params),
+      instShiftAmt(params.instShiftAmt),
+      confidenceBits(params.confidenceBits),
+      confidenceThreshold(params.confidenceThreshold),
+      predHist(params.numThreads),
+      stats(this)
+{
+    fatal_if(confidenceBits == 0 || confidenceBits > 8,
+             "%s: confidence counters must have 1 to 8 bits\n", name());
+    fatal_if(confidenceThreshold >= (1U << confidenceBits),
+             "%s: confidence threshold %d cannot be reached with %d bit "
+             "counters\n", name(), confidenceThreshold, confidenceBits);
+}
+
+VPredUnit::VPredUnitStats::VPredUnitStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(lookups, statistics::units::Count::get(),
+               "Number of loads looked up in the value predictor"),
+      ADD_STAT(predicted, statistics::units::Count::get(),
+               "Number of loads whose predicted value was used"),
+      ADD_STAT(correct, statistics::units::Count::get(),
+               "Number of used value predictions that were correct"),
+      ADD_STAT(incorrect, statistics::units::Count::get(),
+               "Number of used value predictions that were wrong"),
+      ADD_STAT(lowConfidenceCorrect, statistics::units::Count::get(),
+               "Number of unused value predictions that would have been "
+               "correct"),
+      ADD_STAT(accuracy, statistics::units::Ratio::get(),
+               "Fraction of used value predictions that were correct",
+               correct / (correct + incorrect)),
+      ADD_STAT(coverage, statistics::units::Ratio::get(),
+               "Fraction of looked up loads whose predicted value was used",
+               predicted / lookups),
+      ADD_STAT(correctPCs, statistics::units::Count::get(),
+               "Number of correct value predictions per load PC"),
+      ADD_STAT(incorrectPCs, statistics::units::Count::get(),
+               "Number of wrong value predictions per load PC")
+{
+    accuracy.precision(6);
+    coverage.precision(6);
+    correctPCs.init(0).flags(statistics::nozero);
+    incorrectPCs.init(0).flags(statistics::nozero);
+}
+
+bool
+VPredUnit::predict(const InstSeqNum &seq_num, Addr pc, ThreadID tid,
+                   RegVal &value)
+{
+    assert(predHist[tid].empty() || predHist[tid].back().seqNum < seq_num);
+
+    ++stats.lookups;
+
+    void *vp_history = nullptr;
+    const bool confident = lookup(tid, pc, value, vp_history);
+
+    DPRINTF(ValuePred, "[tid:%i] [sn:%llu] Load at PC %#x predicted value "
+            "%#x, confident:%d\n", tid, seq_num, pc, value, confident);
+
+    if (confident) {
+        ++stats.predicted;
+    }
+
+    predHist[tid].push_back(
+        {seq_num, pc, vp_history, false, confident, false, value, 0});
+
+    return confident;
+}
+
+void
+VPredUnit::dispatchBranch(const InstSeqNum &seq_num, Addr pc, bool taken,
+                          ThreadID tid)
+{
+    assert(predHist[tid].empty() || predHist[tid].back().seqNum < seq_num);
+
+    void *vp_history = nullptr;
+    updateHistory(tid, pc, taken, vp_history);
+    if (vp_history) {
+        predHist[tid].push_back(
+            {seq_num, pc, vp_history, true, false, false, 0, 0});
+    }
+}
+
+VPredUnit::History::const_iterator
+VPredUnit::find(const History &hist, const InstSeqNum &seq_num) const
+{
+    auto it = std::lower_bound(hist.begin(), hist.end(), seq_num,
+        [](const PredictorHistory &entry, const InstSeqNum &sn)
+        {
+            return entry.seqNum < sn;
+        });
+    return it != hist.end() && it->seqNum == seq_num ? it : hist.end();
+}
+
+bool
+VPredUnit::needsVerify(const InstSeqNum &seq_num, ThreadID tid) const
+{
+    const History &hist = predHist[tid];
+    auto it = find(hist, seq_num);
+    return it != hist.end() && !it->isBranch && !it->verified;
+}
+
+bool
+VPredUnit::verify(const InstSeqNum &seq_num, RegVal value, ThreadID tid)
+{
+    History &hist = predHist[tid];
+    auto found = find(hist, seq_num);
+
+    if (found == hist.end() || found->verified) {
+        // The load was not looked up, or was already verified when it was
+        // replayed.
+        return false;
+    }
+    auto it = hist.begin() + (found - hist.cbegin());
+    assert(!it->isBranch);
+
+    it->verified = true;
+    it->loadedValue = value;
+    const bool correct = it->value == value;
+
+    DPRINTF(ValuePred, "[tid:%i] [sn:%llu] Load at PC %#x loaded %#x, "
+            "predicted %#x\n", tid, seq_num, it->pc, value, it->value);
+
+    if (it->confident) {
+        if (correct) {
+            ++stats.correct;
+            stats.correctPCs.sample(it->pc);
+        } else {
+            ++stats.incorrect;
+            stats.incorrectPCs.sample(it->pc);
+        }
+    } else if (correct) {
+        ++stats.lowConfidenceCorrect;
+    }
+
+    return it->confident && !correct;
+}
+
+void
+VPredUnit::update(const InstSeqNum &done_sn, ThreadID tid)
+{
+    History &hist = predHist[tid];
+    while (!hist.empty() && hist.front().seqNum <= done_sn) {
+        const PredictorHistory &entry = hist.front();
+        if (entry.verified) {
+            train(tid, entry.pc, entry.loadedValue, entry.vpHistory);
+        }
+        retire(tid, entry.vpHistory);
+        hist.pop_front();
+    }
+}
+
+void
+VPredUnit::squash(const InstSeqNum &squashed_sn, ThreadID tid)
+{
+    History &hist = predHist[tid];
+    while (!hist.empty() && hist.back().seqNum > squashed_sn) {
+        DPRINTF(ValuePred, "[tid:%i] [sn:%llu] Squashing value prediction "
+                "history for PC %#x\n", tid, hist.back().seqNum,
+                hist.back().pc);
+        squash(tid, hist.back().vpHistory);
+        hist.pop_back();
+    }
+}
+
+void
+VPredUnit::squash(const InstSeqNum &squashed_sn, bool actually_taken,
+                  ThreadID tid)
+{
+    squash(squashed_sn, tid);
+
+    // The branch itself is not squashed, but it went into the history
+    // with its predicted direction
+    History &hist = predHist[tid];
+    if (!hist.empty() && hist.back().seqNum == squashed_sn &&
+            hist.back().isBranch) {
+        DPRINTF(ValuePred, "[tid:%i] [sn:%llu] Correcting branch at PC %#x "
+                "to taken:%d\n", tid, squashed_sn, hist.back().pc,
+                actually_taken);
+        correctHistory(tid, actually_taken, hist.back().vpHistory);
+    }
+}
+
+void
+VPredUnit::drainSanityCheck() const
+{
+    for ([[maybe_unused]] const auto &hist : predHist) {
+        assert(hist.empty());
+    }
+}
+
+} // namespace value_prediction
+} // namespace gem5
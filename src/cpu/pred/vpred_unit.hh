@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_VPRED_UNIT_HH__
+#define __CPU_PRED_VPRED_UNIT_HH__
+
+#include <deque>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "params/ValuePredictor.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+/**
+ * Base class of the load value predictors. It keeps, per thread, the
+ * predictions made for the in-flight instructions in program order, so
+ * that predictions can be verified as loads complete (possibly out of
+ * order), retired at commit, and rolled back on a squash. The tables
+ * are only trained at commit, in program order, so that wrong-path
+ * loads and out of order completion do not disturb them.
+ *
+ * Derived classes implement the actual prediction tables through
+ * lookup(), train(), updateHistory(), squash() and retire(). Like the
+ * branch predictors, they may attach an opaque history object to each
+ * prediction; the unit hands it back exactly once, either to squash()
+ * or to retire(), which must free it.
+ */
+class VPredUnit : public SimObject
+{
+  public:
+    typedef ValuePredictorParams Params;
+
+    VPredUnit(const Params &p);
+
+    /**
+     * Looks up a value for a load that is being dispatched.
+     * @param seq_num Sequence number of the load.
+     * @param pc The unshifted PC of the load.
+     * @param tid The thread id.
+     * @param value The predicted value is passed back through this
+     * parameter.
+     * @return Whether the predictor is confident enough in the value for
+     * it to be used by dependent instructions.
+     */
+    bool predict(const InstSeqNum &seq_num, Addr pc, ThreadID tid,
+                 RegVal &value);
+
+    /**
+     * Informs the predictor of a control instruction being dispatched so
+     * that history based predictors can update their global history.
+     * @param seq_num Sequence number of the branch.
+     * @param pc The unshifted PC of the branch.
+     * @param taken The predicted direction of the branch.
+     * @param tid The thread id.
+     */
+    void dispatchBranch(const InstSeqNum &seq_num, Addr pc, bool taken,
+                        ThreadID tid);
+
+    /**
+     * Checks if a load was looked up and is waiting to be verified, in
+     * which case its loaded value should be passed to verify().
+     * @param seq_num Sequence number of the load.
+     * @param tid The thread id.
+     * @return Whether the load has an unverified prediction.
+     */
+    bool needsVerify(const InstSeqNum &seq_num, ThreadID tid) const;
+
+    /**
+     * Verifies the prediction of a load against the value it loaded. The
+     * value is kept to train the predictor when the load commits.
+     * @param seq_num Sequence number of the load.
+     * @param value The value produced by the load.
+     * @param tid The thread id.
+     * @return True if a predicted value was used and was wrong, in which
+     * case the instructions younger than the load must be squashed.
+     */
+    bool verify(const InstSeqNum &seq_num, RegVal value, ThreadID tid);
+
+    /**
+     * Retires the predictions of all instructions up to the given
+     * sequence number, training the predictor with the values of the
+     * verified loads.
+     * @param done_sn The sequence number of the youngest committed
+     * instruction.
+     * @param tid The thread id.
+     */
+    void update(const InstSeqNum &done_sn, ThreadID tid);
+
+    /**
+     * Squashes the predictions of all instructions younger than the
+     * given sequence number, restoring the predictor history.
+     * @param squashed_sn The sequence number of the youngest instruction
+     * that is not squashed.
+     * @param tid The thread id.
+     */
+    void squash(const InstSeqNum &squashed_sn, ThreadID tid);
+
+    /**
+     * Squashes the predictions of all instructions younger than a
+     * mispredicted branch, and corrects the direction of the branch in
+     * the predictor history.
+     * @param squashed_sn The sequence number of the mispredicted branch.
+     * @param actually_taken The resolved direction of the branch.
+     * @param tid The thread id.
+     */
+    void squash(const InstSeqNum &squashed_sn, bool actually_taken,
+                ThreadID tid);
+
+    /** Perform sanity checks after a drain. */
+    void drainSanityCheck() const;
+
+  protected:
+    /**
+     * Looks up the prediction tables.
+     * @param tid The thread id.
+     * @param pc The unshifted PC of the load.
+     * @param value The predicted value is passed back through this
+     * parameter.
+     * @param vp_history Set to the history object of this prediction.
+     * @return Whether the prediction is confident.
+     */
+    virtual bool lookup(ThreadID tid, Addr pc, RegVal &value,
+                        void * &vp_history) = 0;
+
+    /**
+     * Trains the prediction tables with the value of a committed load.
+     * @param tid The thread id.
+     * @param pc The unshifted PC of the load.
+     * @param value The value produced by the load.
+     * @param vp_history The history object returned by lookup().
+     */
+    virtual void train(ThreadID tid, Addr pc, RegVal value,
+                       void *vp_history) = 0;
+
+    /**
+     * Updates the speculative global history with a branch.
+     * @param vp_history Set to a history object that is able to restore
+     * the global history to its state before this branch.
+     */
+    virtual void
+    updateHistory(ThreadID tid, Addr pc, bool taken, void * &vp_history)
+    {
+    }
+
+    /**
+     * Rewrites the direction of a mispredicted branch in the speculative
+     * global history. Only called for the youngest instruction, once the
+     * younger ones are squashed.
+     * @param taken The resolved direction of the branch.
+     * @param vp_history The history object returned by updateHistory().
+     */
+    virtual void
+    correctHistory(ThreadID tid, bool taken, void *vp_history)
+    {
+    }
+
+    /**
+     * Undoes the speculative effects of a prediction or of a branch and
+     * frees its history object. Called from the youngest to the oldest
+     * squashed instruction.
+     */
+    virtual void squash(ThreadID tid, void *vp_history) = 0;
+
+    /** Frees the history object of a committed instruction. */
+    virtual void retire(ThreadID tid, void *vp_history) = 0;
+
+    /** Computes the table index of a PC. */
+    Addr
+    pcIndex(Addr pc) const
+    {
+        return pc >> instShiftAmt;
+    }
+
+    /** Number of bits to shift instructions by for predictor addresses. */
+    const unsigned instShiftAmt;
+
+    /** Number of bits of the confidence counters. */
+    const unsigned confidenceBits;
+
+    /** Confidence needed for a predicted value to be used. */
+    const unsigned confidenceThreshold;
+
+  private:
+    struct PredictorHistory
+    {
+        /** The sequence number of the instruction. */
+        InstSeqNum seqNum;
+
+        /** The PC of the instruction. */
+        Addr pc;
+
+        /** History object of the derived predictor. */
+        void *vpHistory;
+
+        /** Whether this entry is for a branch rather than a load. */
+        bool isBranch;
+
+        /** Whether the predicted value was used. */
+        bool confident;
+
+        /** Whether the load has been verified. */
+        bool verified;
+
+        /** The predicted value. */
+        RegVal value;
+
+        /** The loaded value, once verified. */
+        RegVal loadedValue;
+    };
+
+    typedef std::deque<PredictorHistory> History;
+
+    /**
+     * Finds the history entry of an instruction.
+     * @return The entry, or the end of the history if there is none.
+     */
+    History::const_iterator find(const History &hist,
+                                 const InstSeqNum &seq_num) const;
+
+    /**
+     * The per-thread predictor history, ordered by sequence number.
+     */
+    std::vector<History> predHist;
+
+    struct VPredUnitStats : public statistics::Group
+    {
+        VPredUnitStats(statistics::Group *parent);
+
+        /** Number of loads looked up. */
+        statistics::Scalar lookups;
+        /** Number of loads whose predicted value was used. */
+        statistics::Scalar predicted;
+        /** Number of used predictions that were correct. */
+        statistics::Scalar correct;
+        /** Number of used predictions that were wrong. */
+        statistics::Scalar incorrect;
+        /** Number of unused predictions that would have been correct. */
+        statistics::Scalar lowConfidenceCorrect;
+        /** Fraction of used predictions that were correct. */
+        statistics::Formula accuracy;
+        /** Fraction of looked up loads whose predicted value was used. */
+        statistics::Formula coverage;
+        /** Number of correct predictions per load PC. */
+        statistics::SparseHistogram correctPCs;
+        /** Number of wrong predictions per load PC. */
+        statistics::SparseHistogram incorrectPCs;
+    } stats;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_VPRED_UNIT_HH__
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/vtage_value_pred.hh"
+
+#include "base/bitfield.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+VTAGEValuePredictor::VTAGEValuePredictor(
+        const VTAGEValuePredictorParams &params)
+    : VPredUnit(params),
+      logBaseTableSize(params.logBaseTableSize),
+      logTaggedTableSize(params.logTaggedTableSize),
+      historyLengths(params.historyLengths),
+      nTaggedTables(params.historyLengths.size()),
+      tagBits(params.tagBits),
+      baseTable(1ULL << params.logBaseTableSize,
+                Entry(params.confidenceBits, params.usefulBits)),
+      taggedTables(nTaggedTables + 1),
+      globalHistory(params.numThreads, 0)
+{
+    fatal_if(nTaggedTables == 0, "%s: VTAGE needs tagged tables\n", name());
+    fatal_if(tagBits < 2, "%s: tags must have at least 2 bits\n", name());
+    for (unsigned i = 0; i < nTaggedTables; i++) {
+        fatal_if(historyLengths[i] == 0 || historyLengths[i] > 64,
+                 "%s: history lengths must be between 1 and 64\n", name());
+        fatal_if(i > 0 && historyLengths[i] <= historyLengths[i - 1],
+                 "%s: history lengths must be increasing\n", name());
+    }
+
+    for (unsigned i = 1; i <= nTaggedTables; i++) {
+        taggedTables[i].resize(1ULL << logTaggedTableSize,
+                               Entry(params.confidenceBits,
+                                     params.usefulBits));
+    }
+}
+
+Addr
+VTAGEValuePredictor::fold(uint64_t history, unsigned length, unsigned bits)
+{
+    if (length < 64) {
+        history &= mask(length);
+    }
+    Addr folded = 0;
+    for (unsigned pos = 0; pos < length; pos += bits) {
+        folded ^= history & mask(bits);
+        history >>= bits;
+    }
+    return folded;
+}
+
+bool
+VTAGEValuePredictor::lookup(ThreadID tid, Addr pc, RegVal &value,
+                            void * &vp_history)
+{
+    VTAGEHistory *history = new VTAGEHistory;
+    history->globalHistory = globalHistory[tid];
+    history->isBranch = false;
+    history->provider = 0;
+    history->indices.resize(nTaggedTables + 1);
+    history->tags.resize(nTaggedTables + 1);
+
+    const Addr pc_idx = pcIndex(pc);
+    const uint64_t ghist = globalHistory[tid];
+
+    history->indices[0] = pc_idx & mask(logBaseTableSize);
+    history->tags[0] = 0;
+    for (unsigned i = 1; i <= nTaggedTables; i++) {
+        const unsigned length = historyLengths[i - 1];
+        history->indices[i] = (pc_idx ^ (pc_idx >> logTaggedTableSize) ^
+                               fold(ghist, length, logTaggedTableSize)) &
+                              mask(logTaggedTableSize);
+        history->tags[i] = (pc_idx ^ fold(ghist, length, tagBits) ^
+                            (fold(ghist, length, tagBits - 1) << 1)) &
+                           mask(tagBits);
+    }
+
+    // The table with the longest matching history provides the value
+    for (unsigned i = nTaggedTables; i > 0; i--) {
+        const Entry &entry = taggedTables[i][history->indices[i]];
+        if (entry.valid && entry.tag == history->tags[i]) {
+            history->provider = i;
+            break;
+        }
+    }
+
+    const unsigned p = history->provider;
+    const Entry &provider = p ? taggedTables[p][history->indices[p]] :
+                                baseTable[history->indices[0]];
+
+    vp_history = history;
+    value = provider.value;
+    return static_cast<unsigned>(provider.confidence) >= confidenceThreshold;
+}
+
+void
+VTAGEValuePredictor::allocate(const VTAGEHistory &history, RegVal value)
+{
+    for (unsigned i = history.provider + 1; i <= nTaggedTables; i++) {
+        Entry &entry = taggedTables[i][history.indices[i]];
+        if (entry.useful == 0) {
+            entry.valid = true;
+            entry.tag = history.tags[i];
+            entry.value = value;
+            entry.confidence.reset();
+            return;
+        }
+    }
+
+    // No entry could be claimed; age the candidates so that one can be
+    // allocated next time
+    for (unsigned i = history.provider + 1; i <= nTaggedTables; i++) {
+        taggedTables[i][history.indices[i]].useful--;
+    }
+}
+
+void
+VTAGEValuePredictor::train(ThreadID tid, Addr pc, RegVal value,
+                           void *vp_history)
+{
+    const VTAGEHistory *history =
+        static_cast<const VTAGEHistory *>(vp_history);
+    assert(history && !history->isBranch);
+
+    const unsigned p = history->provider;
+    Entry *provider = &baseTable[history->indices[0]];
+    if (p) {
+        Entry &entry = taggedTables[p][history->indices[p]];
+        // The entry may have been reallocated since the lookup
+        if (entry.valid && entry.tag == history->tags[p]) {
+            provider = &entry;
+        }
+    }
+
+    if (provider->value == value) {
+        provider->confidence++;
+        if (provider != &baseTable[history->indices[0]]) {
+            provider->useful++;
+        }
+    } else {
+        provider->confidence.reset();
+        if (provider->useful == 0) {
+            provider->value = value;
+        } else {
+            provider->useful--;
+        }
+        allocate(*history, value);
+    }
+
+    // The base table always tracks the last value of the load
+    Entry &base = baseTable[history->indices[0]];
+    if (provider != &base && base.value != value) {
+        base.value = value;
+        base.confidence.reset();
+    }
+}
+
+void
+VTAGEValuePredictor::updateHistory(ThreadID tid, Addr pc, bool taken,
+                                   void * &vp_history)
+{
+    VTAGEHistory *history = new VTAGEHistory;
+    history->globalHistory = globalHistory[tid];
+    history->isBranch = true;
+    history->provider = 0;
+    vp_history = history;
+
+    globalHistory[tid] = (globalHistory[tid] << 1) | (taken ? 1 : 0);
+}
+
+void
+VTAGEValuePredictor::correctHistory(ThreadID tid, bool taken,
+                                    void *vp_history)
+{
+    const VTAGEHistory *history =
+        static_cast<const VTAGEHistory *>(vp_history);
+    assert(history->isBranch);
+
+    globalHistory[tid] = (history->globalHistory << 1) | (taken ? 1 : 0);
+}
+
+void
+VTAGEValuePredictor::squash(ThreadID tid, void *vp_history)
+{
+    VTAGEHistory *history = static_cast<VTAGEHistory *>(vp_history);
+    if (history->isBranch) {
+        globalHistory[tid] = history->globalHistory;
+    }
+    delete history;
+}
+
+void
+VTAGEValuePredictor::retire(ThreadID tid, void *vp_history)
+{
+    delete static_cast<VTAGEHistory *>(vp_history);
+}
+
+} // namespace value_prediction
+} // namespace gem5
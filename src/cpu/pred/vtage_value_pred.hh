@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Implementation of the VTAGE value predictor (Perais and Seznec, "Practical
+ * data value speculation for future high-end processors", HPCA 2014).
+ * VTAGE is the value-prediction counterpart of the TAGE branch predictor: a
+ * PC-indexed last value table backed by several partially tagged tables
+ * indexed with a hash of the PC and of geometrically increasing lengths of
+ * global branch history. The matching table using the longest history
+ * provides the prediction, which is only used if its confidence counter is
+ * high enough.
+ */
+
+#ifndef __CPU_PRED_VTAGE_VALUE_PRED_HH__
+#define __CPU_PRED_VTAGE_VALUE_PRED_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "cpu/pred/vpred_unit.hh"
+#include "params/VTAGEValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+class VTAGEValuePredictor : public VPredUnit
+{
+  public:
+    VTAGEValuePredictor(const VTAGEValuePredictorParams &params);
+
+  protected:
+    bool lookup(ThreadID tid, Addr pc, RegVal &value,
+                void * &vp_history) override;
+    void train(ThreadID tid, Addr pc, RegVal value,
+               void *vp_history) override;
+    void updateHistory(ThreadID tid, Addr pc, bool taken,
+                       void * &vp_history) override;
+    void correctHistory(ThreadID tid, bool taken,
+                        void *vp_history) override;
+    void squash(ThreadID tid, void *vp_history) override;
+    void retire(ThreadID tid, void *vp_history) override;
+
+    struct Entry
+    {
+        Entry(unsigned conf_bits, unsigned useful_bits)
+            : valid(false), tag(0), value(0), confidence(conf_bits),
+              useful(useful_bits)
+        {}
+
+        /** Whether the entry was ever allocated, unused by the base. */
+        bool valid;
+        Addr tag;
+        RegVal value;
+        SatCounter8 confidence;
+        SatCounter8 useful;
+    };
+
+    /** State recorded when looking up a load or dispatching a branch. */
+    struct VTAGEHistory
+    {
+        /** Global history before a branch, restored on a squash. */
+        uint64_t globalHistory;
+        /** Whether this history belongs to a branch. */
+        bool isBranch;
+        /** Table providing the prediction, 0 being the base table. */
+        unsigned provider;
+        /** Indices and tags computed for each table at lookup. */
+        std::vector<unsigned> indices;
+        std::vector<Addr> tags;
+    };
+
+    /**
+     * Folds the most recent bits of a global history into a smaller
+     * number of bits.
+     * @param history The global history.
+     * @param length The number of history bits to use.
+     * @param bits The width of the result.
+     */
+    static Addr fold(uint64_t history, unsigned length, unsigned bits);
+
+    /**
+     * Allocates an entry for a mispredicted load in one of the tables
+     * using a longer history than the provider.
+     */
+    void allocate(const VTAGEHistory &history, RegVal value);
+
+    const unsigned logBaseTableSize;
+    const unsigned logTaggedTableSize;
+    const std::vector<unsigned> historyLengths;
+    const unsigned nTaggedTables;
+    const unsigned tagBits;
+
+    /** The PC-indexed base table. */
+    std::vector<Entry> baseTable;
+
+    /** The tagged tables, indexed from 1. */
+    std::vector<std::vector<Entry>> taggedTables;
+
+    /** Speculative per-thread global branch history, youngest in bit 0. */
+    std::vector<uint64_t> globalHistory;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_VTAGE_VALUE_PRED_HH__
@@ -0,0 +1,69 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.objects.ClockedObject import ClockedObject
+
+# CXLLink models the CXL.mem link between a host and a Type-3 memory
+# expander, accounting for the packing of messages into flits, the
+# link layer credits, and the latency of the ports at both ends.
+
+
+class CXLLink(ClockedObject):
+    type = "CXLLink"
+    cxx_header = "mem/cxl_link.hh"
+    cxx_class = "gem5::CXLLink"
+
+    mem_side_port = RequestPort(
+        "This port sends requests to the device and receives responses"
+    )
+    cpu_side_port = ResponsePort(
+        "This port receives requests from the host and sends responses"
+    )
+    ranges = VectorParam.AddrRange(
+        [AllMemory], "Address ranges to pass through the link"
+    )
+
+    # The defaults correspond to a x16 link at 32 GT/s using the 68B
+    # flits of CXL 1.1 and 2.0, which carry four 16B slots. The first
+    # slot of a message holds its header, and data follows in further
+    # slots, so a read request takes one slot and a 64B data response
+    # five.
+    num_lanes = Param.Unsigned(16, "Number of lanes of the link")
+    link_speed = Param.UInt64(32, "Speed of each lane (Gb/s)")
+    flit_size = Param.Unsigned(68, "Size of a flit in bytes, including CRC")
+    slots_per_flit = Param.Unsigned(4, "Number of slots in a flit")
+    slot_size = Param.Unsigned(16, "Size of a flit slot in bytes")
+
+    # Latency of the CXL port at each end of the link, i.e. the host
+    # root port and the device port, covering the transaction, link
+    # and physical layers. Every crossing pays it twice.
+    port_latency = Param.Latency("25ns", "Latency of each port of the link")
+
+    # Link layer credits, i.e. the number of messages the receiving
+    # side of each direction can buffer
+    req_credits = Param.Unsigned(32, "Number of host to device credits")
+    resp_credits = Param.Unsigned(32, "Number of device to host credits")
@@ -0,0 +1,75 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.objects.ClockedObject import ClockedObject
+
+
+# A DRAM cache controller, using a memory, typically a die-stacked HBM
+# device behind its own MemCtrl, as a direct-mapped or set-associative
+# cache of the lines of a larger backing memory, with the tags in the
+# DRAM. The memory holding the cache must not be part of the system
+# address map, e.g. with a DRAM interface created with in_addr_map=False
+class DRAMCacheCtrl(ClockedObject):
+    type = "DRAMCacheCtrl"
+    cxx_header = "mem/dram_cache_ctrl.hh"
+    cxx_class = "gem5::memory::DRAMCacheCtrl"
+
+    cpu_side_port = ResponsePort(
+        "This port receives requests and sends responses"
+    )
+    cache_side_port = RequestPort("Port to the memory holding the cache")
+    mem_side_port = RequestPort("Port to the backing memory")
+
+    system = Param.System(Parent.any, "System the controller is part of")
+
+    size = Param.MemorySize("Capacity of the cache")
+    assoc = Param.Unsigned(1, "Associativity, 1 for a direct-mapped cache")
+    block_size = Param.Unsigned(Parent.cache_line_size, "Cache line size")
+    cache_base = Param.Addr(
+        0, "Address of the cache in the memory behind the cache side port"
+    )
+
+    tag_latency = Param.Cycles(
+        1, "Cycles to check the tags once they have been read"
+    )
+    response_latency = Param.Cycles(
+        1, "Cycles to respond once the data is available"
+    )
+
+    request_buffer_size = Param.Unsigned(64, "Number of buffered requests")
+    write_buffer_size = Param.Unsigned(
+        32, "Number of write backs held while reads of the backing memory "
+        "are pending"
+    )
+
+    # MAP-I style hit/miss predictor, reads predicted to miss access the
+    # backing memory in parallel with the tag check
+    predictor_entries = Param.Unsigned(
+        256, "Number of entries of the hit/miss predictor, 0 to disable it"
+    )
+    predictor_bits = Param.Unsigned(3, "Bits of the predictor counters")
@@ -48,6 +48,25 @@ class PageManage(Enum):
     vals = ["open", "open_adaptive", "close", "close_adaptive"]
 
 
+# Enum for the refresh granularity. An all-bank refresh (REFab) closes
+# and refreshes every bank of the rank at once, a same-bank refresh
+# (DDR5 REFsb) refreshes the bank with the same index in every bank
+# group, and a per-bank refresh (LPDDR5/HBM REFpb) a single bank. The
+# latter two leave the other banks of the rank available for accesses.
+class RefreshMode(Enum):
+    vals = ["all_bank", "same_bank", "per_bank"]
+
+
+# Enum for the Rowhammer mitigation. With rfm, the rolling accumulated
+# activations (RAA) of a bank trigger a refresh management command, with
+# trr the activations of a single row trigger a targeted refresh of its
+# neighbours, and with prac (per-row activation counting) a row reaching
+# the threshold raises an alert, making the whole rank back off to
+# issue RFMs.
+class RowhammerMitigation(Enum):
+    vals = ["none", "rfm", "trr", "prac"]
+
+
 class DRAMInterface(MemInterface):
     type = "DRAMInterface"
     cxx_header = "mem/dram_interface.hh"
@@ -56,6 +75,38 @@ class DRAMInterface(MemInterface):
     # scheduler page policy
     page_policy = Param.PageManage("open_adaptive", "Page management policy")
 
+    # programmable XOR address mapping, each field overriding the
+    # corresponding one of addr_mapping when set, e.g. to reproduce the
+    # bank hashing of a memory controller. Mask i selects the physical
+    # address bits whose parity is bit i of the field. The bank group is
+    # the low-order part of the bank number, and the bank masks give
+    # the bank within its group. Channels are selected by the masks of
+    # the address range.
+    rank_masks = VectorParam.Addr([], "XOR masks of the rank bits")
+    bank_group_masks = VectorParam.Addr(
+        [], "XOR masks of the bank group bits"
+    )
+    bank_masks = VectorParam.Addr(
+        [], "XOR masks of the bank bits within a bank group"
+    )
+    row_masks = VectorParam.Addr([], "XOR masks of the row bits")
+
+    # Rowhammer mitigation, triggered when the activations reach the
+    # threshold, the RAA initial management threshold (RAAIMT) for rfm
+    # and the activations of a row for trr and prac. RAA counts are
+    # reduced by refreshes, and row counts start anew every refresh
+    # window. The mitigations of a bank are issued as soon as it is
+    # precharged, and block it for tRFM
+    rowhammer_mitigation = Param.RowhammerMitigation(
+        "none", "Rowhammer mitigation"
+    )
+    rh_threshold = Param.Unsigned(32, "Activations triggering a mitigation")
+    tRFM = Param.Latency(Self.tRFCsb, "Refresh management time")
+    # a PRAC alert leaves tABO_ACT for normal operation, after which the
+    # rank is closed for a number of RFMs
+    prac_rfms = Param.Unsigned(1, "RFM commands per PRAC back-off")
+    tABO_ACT = Param.Latency("180ns", "PRAC alert to back-off delay")
+
     # enforce a limit on the number of accesses per row
     max_accesses_per_row = Param.Unsigned(
         16, "Max accesses per row before closing"
@@ -137,6 +188,22 @@ class DRAMInterface(MemInterface):
     # to be sent. It is 7.8 us for a 64ms refresh requirement
     tREFI = Param.Latency("Refresh command interval")
 
+    # refresh granularity, with same-bank and per-bank refresh every bank
+    # is refreshed once per tREFIsb, the bank sets taking turns at an
+    # interval of tREFIsb divided by the number of sets
+    refresh_mode = Param.RefreshMode("all_bank", "Refresh granularity")
+
+    # time taken to complete a same-bank or per-bank refresh, only used
+    # when the refresh mode is not all_bank
+    tRFCsb = Param.Latency("0ns", "Same-bank or per-bank refresh cycle time")
+
+    # interval in which every bank set is refreshed once, only used when
+    # the refresh mode is not all_bank, e.g. tREFI2 for DDR5 fine
+    # granularity refresh; tREFI is used if it is not set
+    tREFIsb = Param.Latency(
+        "0ns", "Same-bank or per-bank refresh interval of a whole rank"
+    )
+
     # write-to-read, same rank turnaround penalty for same bank group
     tWTR_L = Param.Latency(
         Self.tWTR,
@@ -185,6 +252,11 @@ class DRAMInterface(MemInterface):
 
     data_clock_sync = Param.Bool(False, "Synchronization commands required")
 
+    # keep the data clock (LPDDR5 WCK) running between bursts, trading
+    # the synchronisation delay for the clock power, which is not
+    # captured by DRAMPower
+    wck_always_on = Param.Bool(False, "Data clock kept running when idle")
+
     # Currently rolled into other params
     ######################################################################
 
@@ -1328,6 +1400,12 @@ class DDR5_4400_4x8(DRAMInterface):
     # tRFC (Normal) for 16Gb device is 295ns
     tRFC = "295ns"
 
+    # tRFCsb for 16Gb device is 130ns, same-bank refresh is only allowed
+    # in fine granularity refresh mode, where all the banks are refreshed
+    # every tREFI2 (1.95us) when selecting refresh_mode = "same_bank"
+    tRFCsb = "130ns"
+    tREFIsb = "1.95us"
+
     tPPD = "0.908ns"  # 2nCK
     tWR = "30ns"
 
@@ -1606,6 +1684,8 @@ class LPDDR5_5500_1x16_BG_BL32(DRAMInterface):
     # LPDDR5, 8 Gbit/channel for 280ns tRFCab
     tRFC = "210ns"
     tREFI = "3.9us"
+    # tRFCpb for per-bank refresh, refresh_mode = "per_bank"
+    tRFCsb = "120ns"
 
     # Greater of 4 CK or 6.25 ns
     tWTR = "6.25ns"
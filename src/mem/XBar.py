@@ -42,6 +42,8 @@ from m5.proxy import *
 from m5.SimObject import SimObject
 
 from m5.objects.ClockedObject import ClockedObject
+from m5.objects.IndexingPolicies import *
+from m5.objects.ReplacementPolicies import *
 
 
 class BaseXBar(ClockedObject):
@@ -101,6 +103,13 @@ class BaseXBar(ClockedObject):
         False, "Perform address mapping for the default port"
     )
 
+    # Number of entries of the direct-mapped cache of recently decoded
+    # routes, looked up before the address map. Must be a power of 2,
+    # and 0 disables the cache.
+    route_cache_size = Param.Unsigned(
+        64, "Number of entries in the route cache"
+    )
+
 
 class NoncoherentXBar(BaseXBar):
     type = "NoncoherentXBar"
@@ -155,6 +164,31 @@ class SnoopFilter(SimObject):
     # Sanity check on max capacity to track, adjust if needed.
     max_capacity = Param.MemorySize("8MiB", "Maximum capacity of snoop filter")
 
+    # A bounded filter is modelled when an indexing policy is given, in
+    # which case it tracks a fixed number of lines and back-invalidates
+    # the lines it evicts.
+    entries = Param.Unsigned(
+        65536, "Number of lines tracked by a bounded filter"
+    )
+    assoc = Param.Unsigned(16, "Associativity of a bounded filter")
+    indexing_policy = Param.BaseIndexingPolicy(
+        NULL, "Indexing policy of a bounded filter, unbounded if NULL"
+    )
+    replacement_policy = Param.BaseReplacementPolicy(
+        NULL, "Replacement policy of a bounded filter"
+    )
+
+
+class BoundedSnoopFilter(SnoopFilter):
+    # The indexing policy sees every line as a one byte entry, so its
+    # size is the number of entries of the filter. When changing the
+    # number of entries, also set the size of the indexing policy to
+    # match, e.g. "16KiB" for 16384 entries.
+    indexing_policy = SetAssociative(
+        entry_size=1, assoc=Parent.assoc, size=f"{int(SnoopFilter.entries)}B"
+    )
+    replacement_policy = LRURP()
+
 
 # We use a coherent crossbar to connect multiple requestors to the L2
 # caches. Normally this crossbar would be part of the cache itself.
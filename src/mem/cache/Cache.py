@@ -38,10 +38,11 @@
 
 from m5.params import *
 from m5.proxy import *
-from m5.SimObject import SimObject
+from m5.SimObject import *
 
 from m5.objects.ClockedObject import ClockedObject
 from m5.objects.Compressors import BaseCacheCompressor
+from m5.objects.PartitioningPolicies import *
 from m5.objects.Prefetcher import BasePrefetcher
 from m5.objects.ReplacementPolicies import *
 from m5.objects.Tags import *
@@ -83,6 +84,8 @@ class BaseCache(ClockedObject):
     cxx_header = "mem/cache/base.hh"
     cxx_class = "gem5::BaseCache"
 
+    cxx_exports = [PyBindMethod("warmupFromTrace")]
+
     size = Param.MemorySize("Capacity")
     assoc = Param.Unsigned("Associativity")
 
@@ -118,6 +121,32 @@ class BaseCache(ClockedObject):
     replacement_policy = Param.BaseReplacementPolicy(
         LRURP(), "Replacement policy"
     )
+    partition_manager = Param.PartitionManager(
+        NULL, "Partitioning of the cache among its requestors"
+    )
+
+    num_banks = Param.Unsigned(
+        0,
+        "Number of address-interleaved banks, each able to serve an access "
+        "at a time. 0 disables the bank model.",
+    )
+    bank_interleaving = Param.Unsigned(
+        Parent.cache_line_size,
+        "Size, in bytes, of the address chunks interleaved across banks",
+    )
+    tag_array_occupancy = Param.Cycles(
+        1,
+        "Cycles the tag array of a bank is busy for each access: 1 if it "
+        "is pipelined, the tag latency if it is not",
+    )
+    data_array_occupancy = Param.Cycles(
+        1,
+        "Cycles the data array of a bank is busy for each access: 1 if it "
+        "is pipelined, the data latency if it is not",
+    )
+    ports_per_cycle = Param.Unsigned(
+        0, "Requests the cpu side accepts per cycle. 0 means unlimited."
+    )
 
     compressor = Param.BaseCacheCompressor(NULL, "Cache compressor.")
     replace_expansions = Param.Bool(
@@ -156,6 +185,14 @@ class BaseCache(ClockedObject):
     # set to False.
     writeback_clean = Param.Bool(False, "Writeback clean lines")
 
+    # Save the tags, coherence state, replacement state and data of the
+    # cache in checkpoints, so that restored caches are warm. Otherwise
+    # the caches are expected to be written back before checkpointing,
+    # and start cold when restored.
+    checkpoint_contents = Param.Bool(
+        False, "Save and restore the cache contents in checkpoints"
+    )
+
     # Control whether this cache should be mostly inclusive or mostly
     # exclusive with respect to upstream caches. The behaviour on a
     # fill is determined accordingly. For a mostly inclusive cache,
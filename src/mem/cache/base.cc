@@ -45,8 +45,12 @@
 
 #include "mem/cache/base.hh"
 
+#include <zlib.h>
+
 #include "base/compiler.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
+#include "config/have_protobuf.hh"
 #include "debug/Cache.hh"
 #include "debug/CacheComp.hh"
 #include "debug/CachePort.hh"
@@ -63,6 +67,11 @@
 #include "params/WriteAllocator.hh"
 #include "sim/cur_tick.hh"
 
+#if HAVE_PROTOBUF
+#include "proto/packet.pb.h"
+#include "proto/protoio.hh"
+#endif
+
 namespace gem5
 {
 
@@ -88,6 +97,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       prefetcher(p.prefetcher),
       writeAllocator(p.write_allocator),
       writebackClean(p.writeback_clean),
+      checkpointContents(p.checkpoint_contents),
       tempBlockWriteback(nullptr),
       writebackTempBlockAtomicEvent([this]{ writebackTempBlockAtomic(); },
                                     name(), false,
@@ -99,6 +109,17 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       fillLatency(p.data_latency),
       responseLatency(p.response_latency),
       sequentialAccess(p.sequential_access),
+      numBanks(p.num_banks),
+      bankInterleavingBits(floorLog2(p.bank_interleaving)),
+      tagArrayOccupancy(p.tag_array_occupancy),
+      dataArrayOccupancy(p.data_array_occupancy),
+      tagArrayFree(numBanks, Cycles(0)),
+      dataArrayFree(numBanks, Cycles(0)),
+      portsPerCycle(p.ports_per_cycle),
+      portCycle(0),
+      portAccesses(0),
+      freePortsEvent([this]{ clearBlocked(Blocked_NoPorts); },
+                     name() + ".freePortsEvent"),
       numTarget(p.tgts_per_mshr),
       forwardSnoops(true),
       clusivity(p.clusivity),
@@ -124,6 +145,12 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
 
     tempBlock = new TempCacheBlk(blkSize);
 
+    fatal_if(!isPowerOf2(p.bank_interleaving),
+        "The bank interleaving of %s must be a power of 2", name());
+    fatal_if(numBanks && (tagArrayOccupancy == 0 || dataArrayOccupancy == 0),
+        "The arrays of the banks of %s must be busy for at least a cycle",
+        name());
+
     tags->tagsInit();
     if (prefetcher)
         prefetcher->setCache(this);
@@ -135,6 +162,9 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
         "Compressed cache %s does not have a compression algorithm", name());
     if (compressor)
         compressor->setCache(this);
+    fatal_if(compressor && checkpointContents,
+        "Checkpointing the contents of compressed cache %s is not "
+        "supported", name());
 }
 
 BaseCache::~BaseCache()
@@ -339,6 +369,10 @@ BaseCache::handleTimingReqMiss(PacketPtr pkt, MSHR *mshr, CacheBlk *blk,
 
                 assert(pkt->req->requestorId() < system->maxRequestors());
                 stats.cmdStats(pkt).mshrHits[pkt->req->requestorId()]++;
+                if (prefetcher && pkt->isDemand() &&
+                    mshr->getTarget()->pkt->cmd == MemCmd::HardPFReq) {
+                    prefetcher->prefetchTooLate();
+                }
 
                 // We use forward_time here because it is the same
                 // considering new targets. We have multiple
@@ -364,7 +398,7 @@ BaseCache::handleTimingReqMiss(PacketPtr pkt, MSHR *mshr, CacheBlk *blk,
         assert(pkt->req->requestorId() < system->maxRequestors());
         stats.cmdStats(pkt).mshrMisses[pkt->req->requestorId()]++;
         if (prefetcher && pkt->isDemand())
-            prefetcher->incrDemandMhsrMisses();
+            prefetcher->incrDemandMhsrMisses(pkt->getBlockAddr(blkSize));
 
         if (pkt->isEviction() || pkt->cmd == MemCmd::WriteClean) {
             // We use forward_time here because there is an
@@ -400,6 +434,60 @@ BaseCache::handleTimingReqMiss(PacketPtr pkt, MSHR *mshr, CacheBlk *blk,
     }
 }
 
+Cycles
+BaseCache::accessBank(Addr addr, bool access_data)
+{
+    if (numBanks == 0) {
+        return Cycles(0);
+    }
+
+    const unsigned bank = (addr >> bankInterleavingBits) % numBanks;
+    const Cycles now = curCycle();
+
+    // The tags are looked up as soon as the tag array is free
+    const Cycles tag_start = std::max(now, tagArrayFree[bank]);
+    tagArrayFree[bank] = tag_start + tagArrayOccupancy;
+    Cycles start = tag_start;
+
+    // The data array is accessed in parallel to the tags, or after them
+    // if accessed sequentially; a busy data array delays the whole access
+    if (access_data) {
+        const Cycles data_ready = sequentialAccess ?
+            tag_start + lookupLatency : tag_start;
+        const Cycles data_start = std::max(data_ready, dataArrayFree[bank]);
+        dataArrayFree[bank] = data_start + dataArrayOccupancy;
+        start = start + (data_start - data_ready);
+    }
+
+    const Cycles bank_lat = start - now;
+    if (bank_lat > 0) {
+        DPRINTF(Cache, "Access to %#llx waits %d cycles for bank %d\n",
+                addr, bank_lat, bank);
+        stats.bankConflicts++;
+        stats.bankConflictCycles += bank_lat;
+    }
+    return bank_lat;
+}
+
+void
+BaseCache::usePort()
+{
+    if (portsPerCycle == 0) {
+        return;
+    }
+
+    if (curCycle() != portCycle) {
+        portCycle = curCycle();
+        portAccesses = 0;
+    }
+
+    if (++portAccesses == portsPerCycle) {
+        // No more requests can be accepted in this cycle
+        setBlocked(Blocked_NoPorts);
+        schedule(freePortsEvent, clockEdge(Cycles(1)));
+    }
+}
+
 void
 BaseCache::recvTimingReq(PacketPtr pkt)
 {
@@ -430,6 +518,13 @@ BaseCache::recvTimingReq(PacketPtr pkt)
         // access() will set the lat value.
         satisfied = access(pkt, blk, lat, writebacks);
 
+        // The lookup waits for the bank to be free. With sequential
+        // accesses, the data array is only used on hits.
+        const Cycles bank_lat = accessBank(pkt->getAddr(),
+                                           satisfied || !sequentialAccess);
+        lat += bank_lat;
+        forward_time += cyclesToTicks(bank_lat);
+
         // After the evicted blocks are selected, they must be forwarded
         // to the write buffer to ensure they logically precede anything
         // happening below
@@ -558,6 +653,10 @@ BaseCache::recvTimingResp(PacketPtr pkt)
         blk = handleFill(pkt, blk, writebacks, allocate);
         assert(blk != nullptr);
         ppFill->notify(pkt);
+
+        // The fill is buffered until it can be written, but it keeps the
+        // bank busy for the accesses that follow
+        accessBank(pkt->getAddr(), true);
     }
 
     // Don't want to promote the Locked RMW Read until
@@ -987,9 +1086,8 @@ BaseCache::updateCompressionData(CacheBlk *&blk, const uint64_t* data,
     // metadata can be updated.
     Cycles compression_lat = Cycles(0);
     Cycles decompression_lat = Cycles(0);
-    const auto comp_data =
-        compressor->compress(data, compression_lat, decompression_lat);
-    std::size_t compression_size = comp_data->getSizeBits();
+    std::size_t compression_size = compressor->compressedSizeBits(data,
+        compression_lat, decompression_lat);
 
     // Get previous compressed size
     CompressionBlk* compression_blk = static_cast<CompressionBlk*>(blk);
@@ -1024,7 +1122,8 @@ BaseCache::updateCompressionData(CacheBlk *&blk, const uint64_t* data,
         CacheBlk *victim = nullptr;
         if (replaceExpansions || is_data_contraction) {
             victim = tags->findVictim(regenerateBlkAddr(blk),
-                blk->isSecure(), compression_size, evict_blks);
+                blk->isSecure(), compression_size, evict_blks,
+                blk->getSrcRequestorId());
 
             // It is valid to return nullptr if there is no victim
             if (!victim) {
@@ -1625,15 +1724,14 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
     // calculate the amount of extra cycles needed to read or write compressed
     // blocks.
     if (compressor && pkt->hasData()) {
-        const auto comp_data = compressor->compress(
+        blk_size_bits = compressor->compressedSizeBits(
             pkt->getConstPtr<uint64_t>(), compression_lat, decompression_lat);
-        blk_size_bits = comp_data->getSizeBits();
     }
 
     // Find replacement victim
     std::vector<CacheBlk*> evict_blks;
     CacheBlk *victim = tags->findVictim(addr, is_secure, blk_size_bits,
-                                        evict_blks);
+                                        evict_blks, pkt->req->requestorId());
 
     // It is valid to return nullptr if there is no victim
     if (!victim)
@@ -1642,11 +1740,27 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
     // Print victim block's information
     DPRINTF(CacheRepl, "Replacement victim: %s\n", victim->print());
 
+    // Remember the blocks prefetches evict, to detect the misses they
+    // cause; the addresses are taken before the blocks are invalidated,
+    // but only recorded if the evictions succeed
+    std::vector<Addr> pf_evicted;
+    if (prefetcher && pkt->cmd == MemCmd::HardPFResp) {
+        for (const auto &blk : evict_blks) {
+            if (blk->isValid()) {
+                pf_evicted.push_back(regenerateBlkAddr(blk));
+            }
+        }
+    }
+
     // Try to evict blocks; if it fails, give up on allocation
     if (!handleEvictions(evict_blks, writebacks)) {
         return nullptr;
     }
 
+    for (const Addr blk_addr : pf_evicted) {
+        prefetcher->prefetchEvicted(blk_addr);
+    }
+
     // Insert new block at victimized entry
     tags->insertBlock(pkt, victim);
 
@@ -1788,12 +1902,18 @@ BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
 void
 BaseCache::memWriteback()
 {
-    tags->forEachBlk([this](CacheBlk &blk) { writebackVisitor(blk); });
+    tags->forEachBlk([this](CacheBlk &blk) {
+        if (checkpointContents && blk.isSet(CacheBlk::DirtyBit)) {
+            writtenBackBlks.insert(&blk);
+        }
+        writebackVisitor(blk);
+    });
 }
 
 void
 BaseCache::memInvalidate()
 {
+    writtenBackBlks.clear();
     tags->forEachBlk([this](CacheBlk &blk) { invalidateVisitor(blk); });
 }
 
@@ -1833,6 +1953,142 @@ BaseCache::writebackVisitor(CacheBlk &blk)
     }
 }
 
+void
+BaseCache::warmup(const std::vector<WarmupAccess> &accesses)
+{
+    panic_if(!mshrQueue.isEmpty() || !writeBuffer.isEmpty(),
+             "%s: cannot warm a cache with outstanding requests\n", name());
+    fatal_if(memSidePort.isSnoopedFromBelow(),
+             "%s: cannot warm a cache whose memory side is snooped, e.g. "
+             "by a coherent crossbar, as the coherence below would not "
+             "know about the warmed blocks\n", name());
+
+    std::vector<uint8_t> data(blkSize);
+    for (const auto &access : accesses) {
+        RequestPtr req = std::make_shared<Request>(
+            access.addr & ~Addr(blkSize - 1), blkSize, 0,
+            access.requestorId);
+        if (access.isSecure) {
+            req->setFlags(Request::SECURE);
+        }
+        if (access.pc != MaxAddr) {
+            req->setPC(access.pc);
+        }
+        Packet pkt(req, access.isWrite ? MemCmd::WriteReq : MemCmd::ReadReq);
+
+        stats.warmupAccesses++;
+
+        Cycles lat;
+        CacheBlk *blk = tags->accessBlock(&pkt, lat);
+        const bool miss = blk == nullptr;
+        if (miss) {
+            stats.warmupMisses++;
+            blk = warmupFill(req, data.data());
+            if (!blk) {
+                continue;
+            }
+        }
+
+        // the blocks are left clean and shared, even when written: the
+        // data is the one of memory, and the caches are warmed
+        // independently, so none of them can claim to be the owner
+
+        if (prefetcher) {
+            pkt.dataStatic(blk->data);
+            prefetcher->warmup(&pkt, miss);
+        }
+    }
+}
+
+CacheBlk *
+BaseCache::warmupFill(const RequestPtr &req, uint8_t *data)
+{
+    Packet pkt(req, MemCmd::ReadReq);
+    pkt.dataStatic(data);
+    memSidePort.sendFunctional(&pkt);
+
+    std::size_t blk_size_bits = blkSize*8;
+    Cycles compression_lat = Cycles(0);
+    Cycles decompression_lat = Cycles(0);
+    if (compressor) {
+        blk_size_bits = compressor->compressedSizeBits(
+            pkt.getConstPtr<uint64_t>(), compression_lat, decompression_lat);
+    }
+
+    std::vector<CacheBlk*> evict_blks;
+    CacheBlk *victim = tags->findVictim(req->getPaddr(), req->isSecure(),
+                                        blk_size_bits, evict_blks,
+                                        req->requestorId());
+    if (!victim) {
+        return nullptr;
+    }
+
+    for (auto &blk : evict_blks) {
+        if (blk->isValid()) {
+            // the warmed blocks are never in flight, so the victims can
+            // be written back and dropped right away
+            writebackVisitor(*blk);
+            invalidateBlock(blk);
+        }
+    }
+
+    tags->insertBlock(&pkt, victim);
+    if (compressor) {
+        compressor->setSizeBits(victim, blk_size_bits);
+        compressor->setDecompressionLatency(victim, decompression_lat);
+    }
+
+    victim->setCoherenceBits(CacheBlk::ReadableBit);
+    updateBlockData(victim, &pkt, false);
+    victim->setWhenReady(curTick());
+
+    return victim;
+}
+
+void
+BaseCache::warmupFromTrace(const std::string &trace_file)
+{
+#if HAVE_PROTOBUF
+    ProtoInputStream trace(trace_file);
+
+    ProtoMessage::PacketHeader header_msg;
+    fatal_if(!trace.read(header_msg),
+             "%s: failed to read header from trace %s\n", name(),
+             trace_file);
+
+    // warm in batches to bound the memory used by large traces
+    const size_t batch_size = 4096;
+    std::vector<WarmupAccess> accesses;
+    accesses.reserve(batch_size);
+
+    ProtoMessage::Packet pkt_msg;
+    while (trace.read(pkt_msg)) {
+        const MemCmd cmd(pkt_msg.cmd());
+        const Request::Flags flags(pkt_msg.has_flags() ? pkt_msg.flags() : 0);
+        if (!cmd.isRequest() || !(cmd.isRead() || cmd.isWrite()) ||
+            flags.isSet(Request::UNCACHEABLE) ||
+            !inRange(pkt_msg.addr())) {
+            continue;
+        }
+
+        WarmupAccess access;
+        access.addr = pkt_msg.addr();
+        access.pc = pkt_msg.has_pc() ? pkt_msg.pc() : MaxAddr;
+        access.isWrite = cmd.isWrite();
+        access.isSecure = flags.isSet(Request::SECURE);
+        accesses.push_back(access);
+
+        if (accesses.size() == batch_size) {
+            warmup(accesses);
+            accesses.clear();
+        }
+    }
+    warmup(accesses);
+#else
+    fatal("%s: warming from a trace requires protobuf support\n", name());
+#endif
+}
+
 void
 BaseCache::invalidateVisitor(CacheBlk &blk)
 {
@@ -1993,7 +2249,7 @@ BaseCache::sendWriteQueuePacket(WriteQueueEntry* wq_entry)
 void
 BaseCache::serialize(CheckpointOut &cp) const
 {
-    bool dirty(isDirty());
+    bool dirty(isDirty() && !checkpointContents);
 
     if (dirty) {
         warn("*** The cache still contains dirty data. ***\n");
@@ -2008,6 +2264,10 @@ BaseCache::serialize(CheckpointOut &cp) const
     // cache contains dirty data.
     bool bad_checkpoint(dirty);
     SERIALIZE_SCALAR(bad_checkpoint);
+
+    if (checkpointContents) {
+        serializeContents(cp);
+    }
 }
 
 void
@@ -2020,6 +2280,173 @@ BaseCache::unserialize(CheckpointIn &cp)
               "supported in the classic memory system. Please remove any "
               "caches or drain them properly before taking checkpoints.\n");
     }
+
+    if (checkpointContents) {
+        unserializeContents(cp);
+    }
+}
+
+void
+BaseCache::drainResume()
+{
+    ClockedObject::drainResume();
+    writtenBackBlks.clear();
+}
+
+namespace
+{
+
+/** Header of a block of the cache contents saved in a checkpoint. */
+struct ContentsBlkRecord
+{
+    /** Position of the block in the tags. */
+    uint64_t index;
+    /** Block address. */
+    uint64_t addr;
+    /** Replacement state, as given by the tags. */
+    uint64_t replState;
+    /** Task id of the block. */
+    uint32_t taskId;
+    /** Requestor that brought the block in. */
+    uint16_t requestorId;
+    /** Combination of the ContentsBlkBits. */
+    uint16_t bits;
+};
+
+enum ContentsBlkBits : uint16_t
+{
+    ContentsSecure = 0x01,
+    ContentsReadable = 0x02,
+    ContentsWritable = 0x04,
+    ContentsDirty = 0x08,
+    ContentsPrefetched = 0x10,
+};
+
+} // anonymous namespace
+
+void
+BaseCache::serializeContents(CheckpointOut &cp) const
+{
+    std::string contents_file = name() + ".contents";
+    SERIALIZE_SCALAR(contents_file);
+
+    std::string filepath = CheckpointIn::dir() + "/" + contents_file;
+    gzFile compressed = gzopen(filepath.c_str(), "wb");
+    fatal_if(compressed == NULL,
+             "Can't open cache checkpoint file '%s'\n", contents_file);
+
+    uint64_t num_blks = 0;
+    uint64_t total_blks = 0;
+    tags->forEachBlk([&](CacheBlk &blk) {
+        const uint64_t index = total_blks++;
+        if (!blk.isValid()) {
+            return;
+        }
+
+        ContentsBlkRecord record;
+        record.index = index;
+        record.addr = tags->regenerateBlkAddr(&blk);
+        record.replState = tags->getReplacementState(&blk);
+        record.taskId = blk.getTaskId();
+        record.requestorId = blk.getSrcRequestorId();
+        record.bits =
+            (blk.isSecure() ? ContentsSecure : 0) |
+            (blk.isSet(CacheBlk::ReadableBit) ? ContentsReadable : 0) |
+            (blk.isSet(CacheBlk::WritableBit) ? ContentsWritable : 0) |
+            (blk.isSet(CacheBlk::DirtyBit) || writtenBackBlks.count(&blk) ?
+             ContentsDirty : 0) |
+            (blk.wasPrefetched() ? ContentsPrefetched : 0);
+
+        if (gzwrite(compressed, &record, sizeof(record)) != sizeof(record) ||
+            gzwrite(compressed, blk.data, blkSize) != (int)blkSize) {
+            fatal("Write failed on cache checkpoint file '%s'\n",
+                  contents_file);
+        }
+        num_blks++;
+    });
+
+    if (gzclose(compressed))
+        fatal("Close failed on cache checkpoint file '%s'\n", contents_file);
+
+    unsigned blk_size = blkSize;
+    SERIALIZE_SCALAR(blk_size);
+    SERIALIZE_SCALAR(total_blks);
+    SERIALIZE_SCALAR(num_blks);
+}
+
+void
+BaseCache::unserializeContents(CheckpointIn &cp)
+{
+    std::string contents_file;
+    if (!UNSERIALIZE_OPT_SCALAR(contents_file)) {
+        warn("%s: the checkpoint holds no cache contents, the cache starts "
+             "cold\n", name());
+        return;
+    }
+
+    std::vector<CacheBlk*> blks;
+    tags->forEachBlk([&](CacheBlk &blk) { blks.push_back(&blk); });
+
+    unsigned blk_size;
+    uint64_t total_blks;
+    uint64_t num_blks;
+    UNSERIALIZE_SCALAR(blk_size);
+    UNSERIALIZE_SCALAR(total_blks);
+    UNSERIALIZE_SCALAR(num_blks);
+    fatal_if(blk_size != blkSize || total_blks != blks.size(),
+             "%s: the cache organization has changed, its contents cannot "
+             "be restored\n", name());
+
+    std::string filepath = cp.getCptDir() + "/" + contents_file;
+    gzFile compressed = gzopen(filepath.c_str(), "rb");
+    fatal_if(compressed == NULL,
+             "Can't open cache checkpoint file '%s'\n", contents_file);
+
+    std::vector<uint8_t> data(blkSize);
+    for (uint64_t i = 0; i < num_blks; i++) {
+        ContentsBlkRecord record;
+        if (gzread(compressed, &record, sizeof(record)) != sizeof(record) ||
+            gzread(compressed, data.data(), blkSize) != (int)blkSize ||
+            record.index >= blks.size()) {
+            fatal("Read failed on cache checkpoint file '%s'\n",
+                  contents_file);
+        }
+
+        RequestorID requestor_id = record.requestorId;
+        if (requestor_id >= system->maxRequestors()) {
+            requestor_id = Request::funcRequestorId;
+        }
+        RequestPtr req = std::make_shared<Request>(
+            record.addr, blkSize, 0, requestor_id);
+        if (record.bits & ContentsSecure) {
+            req->setFlags(Request::SECURE);
+        }
+        req->taskId(record.taskId);
+        Packet pkt(req, MemCmd::ReadReq);
+        pkt.dataStatic(data.data());
+
+        CacheBlk *blk = blks[record.index];
+        tags->insertBlock(&pkt, blk);
+        tags->setReplacementState(blk, record.replState);
+
+        if (record.bits & ContentsReadable) {
+            blk->setCoherenceBits(CacheBlk::ReadableBit);
+        }
+        if (record.bits & ContentsWritable) {
+            blk->setCoherenceBits(CacheBlk::WritableBit);
+        }
+        if (record.bits & ContentsDirty) {
+            blk->setCoherenceBits(CacheBlk::DirtyBit);
+        }
+        if (record.bits & ContentsPrefetched) {
+            blk->setPrefetched();
+        }
+        updateBlockData(blk, &pkt, false);
+        blk->setWhenReady(curTick());
+    }
+
+    if (gzclose(compressed))
+        fatal("Close failed on cache checkpoint file '%s'\n", contents_file);
 }
 
 
@@ -2236,6 +2663,10 @@ BaseCache::CacheStats::CacheStats(BaseCache &c)
     ADD_STAT(avgBlocked, statistics::units::Rate<
                 statistics::units::Cycle, statistics::units::Count>::get(),
              "average number of cycles each access was blocked"),
+    ADD_STAT(bankConflicts, statistics::units::Count::get(),
+             "number of accesses that waited for a busy bank"),
+    ADD_STAT(bankConflictCycles, statistics::units::Cycle::get(),
+             "number of cycles accesses waited for busy banks"),
     ADD_STAT(writebacks, statistics::units::Count::get(),
              "number of writebacks"),
     ADD_STAT(demandMshrHits, statistics::units::Count::get(),
@@ -2273,6 +2704,10 @@ BaseCache::CacheStats::CacheStats(BaseCache &c)
              "number of data expansions"),
     ADD_STAT(dataContractions, statistics::units::Count::get(),
              "number of data contractions"),
+    ADD_STAT(warmupAccesses, statistics::units::Count::get(),
+             "number of functional warming accesses"),
+    ADD_STAT(warmupMisses, statistics::units::Count::get(),
+             "number of functional warming accesses that missed"),
     cmd(MemCmd::NUM_MEM_CMDS)
 {
     for (int idx = 0; idx < MemCmd::NUM_MEM_CMDS; ++idx)
@@ -2392,6 +2827,7 @@ BaseCache::CacheStats::regStats()
     blockedCycles
         .subname(Blocked_NoMSHRs, "no_mshrs")
         .subname(Blocked_NoTargets, "no_targets")
+        .subname(Blocked_NoPorts, "no_ports")
         ;
 
 
@@ -2399,11 +2835,13 @@ BaseCache::CacheStats::regStats()
     blockedCauses
         .subname(Blocked_NoMSHRs, "no_mshrs")
         .subname(Blocked_NoTargets, "no_targets")
+        .subname(Blocked_NoPorts, "no_ports")
         ;
 
     avgBlocked
         .subname(Blocked_NoMSHRs, "no_mshrs")
         .subname(Blocked_NoTargets, "no_targets")
+        .subname(Blocked_NoPorts, "no_ports")
         ;
     avgBlocked = blockedCycles / blockedCauses;
 
@@ -2560,6 +2998,9 @@ BaseCache::CpuSidePort::recvTimingReq(PacketPtr pkt)
         assert(success);
         return true;
     } else if (tryTiming(pkt)) {
+        if (!pkt->isExpressSnoop()) {
+            cache.usePort();
+        }
         cache.recvTimingReq(pkt);
         return true;
     }
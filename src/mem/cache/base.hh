@@ -49,6 +49,8 @@
 #include <cassert>
 #include <cstdint>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "base/compiler.hh"
@@ -112,6 +114,7 @@ class BaseCache : public ClockedObject
         Blocked_NoMSHRs = MSHRQueue_MSHRs,
         Blocked_NoWBBuffers = MSHRQueue_WriteBuffer,
         Blocked_NoTargets,
+        Blocked_NoPorts,
         NUM_BLOCKED_CAUSES
     };
 
@@ -163,12 +166,20 @@ class BaseCache : public ClockedObject
             reqQueue.schedSendEvent(time);
         }
 
+        /**
+         * Check if a peer below asked whether this port snoops, which
+         * only the ports tracking or forwarding snoops do, e.g. coherent
+         * crossbars, Ruby and caches.
+         */
+        bool isSnoopedFromBelow() const { return snoopedFromBelow; }
+
       protected:
 
         CacheRequestPort(const std::string &_name,
                         ReqPacketQueue &_reqQueue,
                         SnoopRespPacketQueue &_snoopRespQueue) :
-            QueuedRequestPort(_name, _reqQueue, _snoopRespQueue)
+            QueuedRequestPort(_name, _reqQueue, _snoopRespQueue),
+            snoopedFromBelow(false)
         { }
 
         /**
@@ -176,7 +187,17 @@ class BaseCache : public ClockedObject
          *
          * @return always true
          */
-        virtual bool isSnooping() const { return true; }
+        virtual bool
+        isSnooping() const
+        {
+            snoopedFromBelow = true;
+            return true;
+        }
+
+      private:
+
+        /** If a peer below asked whether this port snoops. */
+        mutable bool snoopedFromBelow;
     };
 
     /**
@@ -670,6 +691,16 @@ class BaseCache : public ClockedObject
      */
     const bool writebackClean;
 
+    /** Whether the contents of the cache are saved in checkpoints. */
+    const bool checkpointContents;
+
+    /**
+     * The blocks that were dirty before the last memWriteback(). They are
+     * saved as dirty in checkpoints, so that the restored contents have
+     * the state they had before the writeback.
+     */
+    std::unordered_set<const CacheBlk*> writtenBackBlks;
+
     /**
      * Writebacks from the tempBlock, resulting on the response path
      * in atomic mode, must happen after the call to recvAtomic has
@@ -917,6 +948,64 @@ class BaseCache : public ClockedObject
      */
     const bool sequentialAccess;
 
+    /**
+     * The number of banks of the cache, interleaved by address. Each bank
+     * has its own tag and data arrays, which can serve one access at a
+     * time. The bank model is disabled if there are no banks.
+     */
+    const unsigned numBanks;
+
+    /** Log2 of the size of the address chunks interleaved across banks. */
+    const unsigned bankInterleavingBits;
+
+    /**
+     * The cycles a tag array is busy for each access: 1 if it is
+     * pipelined, the tag latency if it is not.
+     */
+    const Cycles tagArrayOccupancy;
+
+    /**
+     * The cycles a data array is busy for each access: 1 if it is
+     * pipelined, the data latency if it is not.
+     */
+    const Cycles dataArrayOccupancy;
+
+    /** The first cycle the tag array of each bank is free. */
+    std::vector<Cycles> tagArrayFree;
+
+    /** The first cycle the data array of each bank is free. */
+    std::vector<Cycles> dataArrayFree;
+
+    /**
+     * The number of requests the cpu side accepts per cycle, unlimited
+     * if zero.
+     */
+    const unsigned portsPerCycle;
+
+    /** The cycle of the requests counted in portAccesses. */
+    Cycles portCycle;
+
+    /** The number of requests accepted in portCycle. */
+    unsigned portAccesses;
+
+    /** Unblocks the cpu side once its ports are free again. */
+    EventFunctionWrapper freePortsEvent;
+
+    /**
+     * Reserve the arrays of the bank of an address for an access.
+     *
+     * @param addr The address accessed.
+     * @param access_data Whether the data array is accessed as well.
+     * @return The cycles the access must wait for the bank.
+     */
+    Cycles accessBank(Addr addr, bool access_data);
+
+    /**
+     * Use a cpu side port for a request, blocking the cpu side until the
+     * next cycle once all ports are used.
+     */
+    void usePort();
+
     /** The number of targets for each MSHR. */
     const int numTarget;
 
@@ -1089,6 +1178,12 @@ class BaseCache : public ClockedObject
         /** The average number of cycles blocked for each blocked cause. */
         statistics::Formula avgBlocked;
 
+        /** Number of accesses that waited for a busy bank. */
+        statistics::Scalar bankConflicts;
+
+        /** Number of cycles accesses waited for busy banks. */
+        statistics::Scalar bankConflictCycles;
+
         /** Number of blocks written back per thread. */
         statistics::Vector writebacks;
 
@@ -1138,6 +1233,12 @@ class BaseCache : public ClockedObject
          */
         statistics::Scalar dataContractions;
 
+        /** Number of functional warming accesses. */
+        statistics::Scalar warmupAccesses;
+
+        /** Number of functional warming accesses that missed. */
+        statistics::Scalar warmupMisses;
+
         /** Per-command statistics */
         std::vector<std::unique_ptr<CacheCmdStats>> cmd;
     } stats;
@@ -1166,6 +1267,51 @@ class BaseCache : public ClockedObject
 
     const AddrRangeList &getAddrRanges() const { return addrRanges; }
 
+    /** An access of a functional warming stream. */
+    struct WarmupAccess
+    {
+        /** Address of the access. */
+        Addr addr;
+        /** Requestor of the access, used for the occupancy stats. */
+        RequestorID requestorId = Request::funcRequestorId;
+        /** PC of the access, MaxAddr if unknown. */
+        Addr pc = MaxAddr;
+        /** Whether the access is a write. */
+        bool isWrite = false;
+        /** Whether the access targets the secure memory space. */
+        bool isSecure = false;
+    };
+
+    /**
+     * Functionally warm the cache with a batch of accesses. The tags,
+     * replacement state and prefetcher are updated as if the accesses
+     * had been made in order, but no timing is modelled and no request
+     * is sent to the memory below, other than functional reads to fill
+     * the missing blocks and functional writebacks of the dirty blocks
+     * evicted. The cache must not have outstanding requests.
+     *
+     * Each cache is only warmed with the accesses it is given, misses
+     * are not forwarded to the caches below. The cache must be right
+     * above memory, or a non-coherent path to it: a coherent crossbar,
+     * Ruby or a cache below would not know about the warmed blocks, so
+     * their snoop filters would not expect the evictions of the blocks,
+     * and their snoops could miss them. Blocks are installed clean
+     * and shared, whether they are read or written, so that caches
+     * warmed independently never hold several owners of a line. Writes
+     * only warm the tags and the replacement state.
+     *
+     * @param accesses The accesses, in program order.
+     */
+    void warmup(const std::vector<WarmupAccess> &accesses);
+
+    /**
+     * Functionally warm the cache with the reads and writes of a packet
+     * trace, as recorded by a MemTraceProbe.
+     *
+     * @param trace_file Name of the trace file.
+     */
+    void warmupFromTrace(const std::string &trace_file);
+
     MSHR *allocateMissBuffer(PacketPtr pkt, Tick time, bool sched_send = true)
     {
         MSHR *mshr = mshrQueue.allocate(pkt->getBlockAddr(blkSize), blkSize,
@@ -1320,6 +1466,16 @@ class BaseCache : public ClockedObject
      */
     void writebackVisitor(CacheBlk &blk);
 
+    /**
+     * Allocate a block for a functional warming miss, filling it with a
+     * functional read from below.
+     *
+     * @param req The request of the block to fill.
+     * @param data Scratch buffer of the size of a block.
+     * @return The allocated block, nullptr if no block could be allocated.
+     */
+    CacheBlk *warmupFill(const RequestPtr &req, uint8_t *data);
+
     /**
      * Cache block visitor that invalidates all blocks in the cache.
      *
@@ -1350,10 +1506,25 @@ class BaseCache : public ClockedObject
     /**
      * Serialize the state of the caches
      *
-     * We currently don't support checkpointing cache state, so this panics.
+     * Unless checkpoint_contents is set, the contents of the cache are
+     * not saved, and checkpoints of caches holding dirty data are
+     * flagged as invalid.
      */
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
+
+    void drainResume() override;
+
+  private:
+    /**
+     * Save the valid blocks of the cache, with their tags, coherence
+     * state, replacement state and data, to a separate file of the
+     * checkpoint.
+     */
+    void serializeContents(CheckpointOut &cp) const;
+
+    /** Restore the blocks saved by serializeContents(). */
+    void unserializeContents(CheckpointIn &cp);
 };
 
 /**
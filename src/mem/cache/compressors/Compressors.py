@@ -64,6 +64,14 @@ class BaseCacheCompressor(SimObject):
         "Number of extra cycles required "
         "to finish decompression (e.g., due to shifting and packaging).",
     )
+    memo_entries = Param.Unsigned(
+        0,
+        "Number of entries of the table memoizing the compressed sizes of "
+        "recently compressed lines, indexed by their contents. Memoized "
+        "compressions count in the patterns of the dictionary compressors, "
+        "but not in the other compressor-specific stats, e.g. the ranks of "
+        "Multi. 0 disables memoization.",
+    )
 
 
 class BaseDictionaryCompressor(BaseCacheCompressor):
@@ -88,7 +88,7 @@ Base::Base(const Params &p)
     compExtraLatency(p.comp_extra_latency),
     decompChunksPerCycle(p.decomp_chunks_per_cycle),
     decompExtraLatency(p.decomp_extra_latency),
-    cache(nullptr), stats(*this)
+    cache(nullptr), memo(p.memo_entries), stats(*this)
 {
     fatal_if(64 % chunkSizeBits,
         "64 must be a multiple of the chunk granularity.");
@@ -101,6 +101,10 @@ Base::Base(const Params &p)
         "chunks in the input");
 
     fatal_if(blkSize < sizeThreshold, "Compressed data must fit in a block");
+
+    for (auto& entry : memo) {
+        entry.line.resize(blkSize / sizeof(uint64_t));
+    }
 }
 
 void
@@ -108,6 +112,9 @@ Base::setCache(BaseCache *_cache)
 {
     assert(!cache);
     cache = _cache;
+
+    fatal_if(!memo.empty() && !isMemoizable(), "The compressions of %s "
+        "depend on its state and cannot be memoized.", name());
 }
 
 std::vector<Base::Chunk>
@@ -119,8 +126,8 @@ Base::toChunks(const uint64_t* data) const
 
     // Turn a 64-bit array into a chunkSizeBits-array
     std::vector<Chunk> chunks((blkSize * CHAR_BIT) / chunkSizeBits, 0);
-    for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+    for (unsigned i = 0; i < chunks.size(); i++) {
+        const unsigned index_64 = i / num_chunks_per_64;
         const unsigned start = i % num_chunks_per_64;
         chunks[i] = bits(data[index_64],
             (start + 1) * chunkSizeBits - 1, start * chunkSizeBits);
@@ -138,8 +145,8 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
 
     // Turn a chunkSizeBits-array into a 64-bit array
     std::memset(data, 0, blkSize);
-    for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+    for (unsigned i = 0; i < chunks.size(); i++) {
+        const unsigned index_64 = i / num_chunks_per_64;
         const unsigned start = i % num_chunks_per_64;
         replaceBits(data[index_64], (start + 1) * chunkSizeBits - 1,
             start * chunkSizeBits, chunks[i]);
@@ -166,12 +173,100 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
              "Decompressed line does not match original line.");
     #endif
 
-    // Get compression size. If compressed size is greater than the size
-    // threshold, the compression is seen as unsuccessful
-    std::size_t comp_size_bits = comp_data->getSizeBits();
+    comp_data->setSizeBits(finishCompression(comp_data->getSizeBits(),
+        comp_lat, decomp_lat));
+
+    return comp_data;
+}
+
+std::size_t
+Base::compressedSizeBits(const std::vector<Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    return compress(chunks, comp_lat, decomp_lat)->getSizeBits();
+}
+
+std::size_t
+Base::hashLine(const uint64_t* data) const
+{
+    uint64_t hash = 0;
+    for (std::size_t i = 0; i < blkSize / sizeof(uint64_t); i++) {
+        hash = (hash ^ data[i]) * 0x9e3779b97f4a7c15ULL;
+    }
+    return hash ^ (hash >> 32);
+}
+
+std::size_t
+Base::compressedSizeBits(const uint64_t* data, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    MemoEntry* entry = nullptr;
+    if (!memo.empty()) {
+        entry = &memo[hashLine(data) % memo.size()];
+        if (entry->valid &&
+            std::equal(entry->line.begin(), entry->line.end(), data)) {
+            stats.memoHits++;
+            if (statistics::Vector *stat = memoizedStat()) {
+                for (std::size_t i = 0; i < entry->statIncrements.size();
+                     i++) {
+                    (*stat)[i] += entry->statIncrements[i];
+                }
+            }
+            comp_lat = entry->compLat;
+            decomp_lat = entry->decompLat;
+            return finishCompression(entry->sizeBits, comp_lat, decomp_lat);
+        }
+    }
+
+    statistics::Vector *stat = entry ? memoizedStat() : nullptr;
+    statistics::VCounter stat_before;
+    if (stat) {
+        stat->value(stat_before);
+    }
+
+    const std::size_t comp_size_bits =
+        compressedSizeBits(toChunks(data), comp_lat, decomp_lat);
+
+    if (entry) {
+        entry->statIncrements.clear();
+        if (stat) {
+            statistics::VCounter stat_after;
+            stat->value(stat_after);
+            for (std::size_t i = 0; i < stat_after.size(); i++) {
+                entry->statIncrements.push_back(
+                    stat_after[i] - stat_before[i]);
+            }
+        }
+    }
+
+    // If we are in debug mode check that the size matches the one of the
+    // full compression
+    #ifdef DEBUG_COMPRESSION
+    Cycles debug_comp_lat, debug_decomp_lat;
+    fatal_if(comp_size_bits != compress(toChunks(data), debug_comp_lat,
+        debug_decomp_lat)->getSizeBits(),
+        "Compressed size does not match the size of the compressed line.");
+    #endif
+
+    if (entry) {
+        entry->valid = true;
+        entry->sizeBits = comp_size_bits;
+        entry->compLat = comp_lat;
+        entry->decompLat = decomp_lat;
+        std::copy(data, data + entry->line.size(), entry->line.begin());
+    }
+
+    return finishCompression(comp_size_bits, comp_lat, decomp_lat);
+}
+
+std::size_t
+Base::finishCompression(std::size_t comp_size_bits, Cycles comp_lat,
+    Cycles decomp_lat)
+{
+    // If compressed size is greater than the size threshold, the
+    // compression is seen as unsuccessful
     if (comp_size_bits > sizeThreshold * CHAR_BIT) {
         comp_size_bits = blkSize * CHAR_BIT;
-        comp_data->setSizeBits(comp_size_bits);
         stats.failedCompressions++;
     }
 
@@ -189,7 +284,7 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
             "Compression latency: %llu, decompression latency: %llu\n",
             blkSize*8, comp_size_bits, comp_lat, decomp_lat);
 
-    return comp_data;
+    return comp_size_bits;
 }
 
 Cycles
@@ -245,7 +340,9 @@ Base::BaseStats::BaseStats(Base& _compressor)
                 statistics::units::Bit, statistics::units::Count>::get(),
              "Average compression size"),
     ADD_STAT(decompressions, statistics::units::Count::get(),
-             "Total number of decompressions")
+             "Total number of decompressions"),
+    ADD_STAT(memoHits, statistics::units::Count::get(),
+             "Number of compressions whose result was memoized")
 {
 }
 
@@ -37,6 +37,8 @@
 #define __MEM_CACHE_COMPRESSORS_BASE_HH__
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/statistics.hh"
@@ -128,6 +130,28 @@ class Base : public SimObject
     /** Pointer to the parent cache. */
     BaseCache* cache;
 
+    /** The result of a previous compression of a given line. */
+    struct MemoEntry
+    {
+        /** Whether the entry holds a result. */
+        bool valid = false;
+        /** The compressed size, before applying the size threshold. */
+        std::size_t sizeBits = 0;
+        Cycles compLat;
+        Cycles decompLat;
+        /** The contents of the line. */
+        std::vector<uint64_t> line;
+        /** The increments of the memoized stat made by the compression. */
+        std::vector<statistics::Counter> statIncrements;
+    };
+
+    /**
+     * Direct-mapped table of the results of the recent compressions,
+     * indexed by a hash of the contents of the lines. Empty if results
+     * are not memoized.
+     */
+    std::vector<MemoEntry> memo;
+
     struct BaseStats : public statistics::Group
     {
         const Base& compressor;
@@ -153,6 +177,9 @@ class Base : public SimObject
 
         /** Number of decompressions performed. */
         statistics::Scalar decompressions;
+
+        /** Number of compressions whose result was memoized. */
+        statistics::Scalar memoHits;
     } stats;
 
     /**
@@ -188,6 +215,30 @@ class Base : public SimObject
         const std::vector<Chunk>& chunks, Cycles& comp_lat,
         Cycles& decomp_lat) = 0;
 
+    /**
+     * Get the size a cache line compresses to. Compressors can override
+     * it to skip building the compressed representation of the line,
+     * which is not needed to model the cache. The result must match the
+     * size of the line given by compress().
+     *
+     * @param chunks The cache line to be compressed, divided into chunks.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return Compressed size, in bits.
+     */
+    virtual std::size_t compressedSizeBits(const std::vector<Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat);
+
+    /**
+     * Get the compressor-specific stat updated by the compressions, if
+     * any. Its increments are memoized along with the compressed sizes,
+     * and made again on memo hits, so that the stat counts the same with
+     * or without memoization.
+     *
+     * @return The stat, or nullptr if there is none.
+     */
+    virtual statistics::Vector *memoizedStat() { return nullptr; }
+
     /**
      * Apply the decompression process to the compressed data.
      *
@@ -197,6 +248,22 @@ class Base : public SimObject
     virtual void decompress(const CompressionData* comp_data,
                               uint64_t* cache_line) = 0;
 
+  private:
+    /** Hash the contents of a line to index the memo table. */
+    std::size_t hashLine(const uint64_t* data) const;
+
+    /**
+     * Apply the size threshold to a compressed size and update the
+     * statistics.
+     *
+     * @param comp_size_bits Compressed size, in bits.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return The size of the line in the cache, in bits.
+     */
+    std::size_t finishCompression(std::size_t comp_size_bits,
+        Cycles comp_lat, Cycles decomp_lat);
+
   public:
     typedef BaseCacheCompressorParams Params;
     Base(const Params &p);
@@ -205,6 +272,12 @@ class Base : public SimObject
     /** The cache can only be set once. */
     virtual void setCache(BaseCache *_cache);
 
+    /**
+     * Whether the compression of a line only depends on its contents, so
+     * that its result can be memoized.
+     */
+    virtual bool isMemoizable() const { return true; }
+
     /**
      * Apply the compression process to the cache line. Ignores compression
      * cycles.
@@ -217,6 +290,19 @@ class Base : public SimObject
     std::unique_ptr<CompressionData>
     compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat);
 
+    /**
+     * Get the size of a cache line in the cache once compressed. This is
+     * all the cache needs to know about a compression; it is cheaper than
+     * compress(), and its results are memoized if enabled.
+     *
+     * @param data The cache line to be compressed.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return Size of the line in the cache, in bits.
+     */
+    std::size_t compressedSizeBits(const uint64_t* data, Cycles& comp_lat,
+        Cycles& decomp_lat);
+
     /**
      * Get the decompression latency if the block is compressed. Latency is 0
      * otherwise.
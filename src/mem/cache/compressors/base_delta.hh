@@ -37,6 +37,8 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "base/bitfield.hh"
 #include "mem/cache/compressors/dictionary_compressor.hh"
@@ -124,6 +126,26 @@ class BaseDelta : public DictionaryCompressor<BaseType>
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
 
+    std::size_t compressedSizeBits(const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
+    /** Whether a value can be stored as a delta from a base. */
+    static bool
+    fitsDelta(const BaseType value, const BaseType base)
+    {
+        using SignedType = std::make_signed_t<BaseType>;
+        const SignedType limit = mask(DeltaSizeBits - 1);
+        const SignedType delta = value - base;
+        return (delta >= -limit) && (delta <= limit);
+    }
+
+  private:
+    /**
+     * The non-zero bases found while calculating a compressed size. Kept
+     * across calls to avoid allocations.
+     */
+    std::vector<BaseType> sizeBases;
+
   public:
     typedef BaseDictionaryCompressorParams Params;
     BaseDelta(const Params &p);
@@ -33,6 +33,8 @@
 #ifndef __MEM_CACHE_COMPRESSORS_BASE_DELTA_IMPL_HH__
 #define __MEM_CACHE_COMPRESSORS_BASE_DELTA_IMPL_HH__
 
+#include <climits>
+
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/base_delta.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
@@ -45,7 +47,8 @@ namespace compression
 
 template <class BaseType, std::size_t DeltaSizeBits>
 BaseDelta<BaseType, DeltaSizeBits>::BaseDelta(const Params &p)
-    : DictionaryCompressor<BaseType>(p)
+    : DictionaryCompressor<BaseType>(p),
+      sizeBases(this->blkSize * CHAR_BIT / this->chunkSizeBits)
 {
 }
 
@@ -97,6 +100,64 @@ BaseDelta<BaseType, DeltaSizeBits>::compress(
     return comp_data;
 }
 
+template <class BaseType, std::size_t DeltaSizeBits>
+std::size_t
+BaseDelta<BaseType, DeltaSizeBits>::compressedSizeBits(
+    const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    static const std::size_t size_x = PatternX(
+        DictionaryCompressor<BaseType>::toDictionaryEntry(0), -1)
+        .getSizeBits();
+    static const std::size_t size_m = PatternM(
+        DictionaryCompressor<BaseType>::toDictionaryEntry(0), 0)
+        .getSizeBits();
+
+    comp_lat = Cycles(this->compExtraLatency +
+        (chunks.size() / this->compChunksPerCycle));
+    decomp_lat = Cycles(this->decompExtraLatency +
+        (chunks.size() / this->decompChunksPerCycle));
+
+    // Values close to the zero base always match it, since it is the
+    // first entry of the dictionary. Count them without branching, so
+    // that the comparisons can be vectorized
+    std::size_t num_zero_matches = 0;
+    for (const auto& chunk : chunks) {
+        num_zero_matches += fitsDelta(chunk, 0);
+    }
+
+    // The other values are matched against the bases in the order they
+    // are found, as in compress(), and allocate a base on a miss
+    std::size_t num_bases = 0;
+    if (num_zero_matches < chunks.size()) {
+        for (const auto& chunk : chunks) {
+            if (fitsDelta(chunk, 0)) {
+                continue;
+            }
+            bool found = false;
+            for (std::size_t i = 0; i < num_bases && !found; i++) {
+                found = fitsDelta(chunk, sizeBases[i]);
+            }
+            if (!found) {
+                sizeBases[num_bases++] = chunk;
+            }
+        }
+    }
+    const std::size_t num_m = chunks.size() - num_bases;
+    this->dictionaryStats.patterns[X] += num_bases;
+    this->dictionaryStats.patterns[M] += num_m;
+
+    // Same base accounting as compress(), with the zero base as an
+    // implicit entry
+    const int diff = DEFAULT_MAX_NUM_BASES - (int)(num_bases + 1);
+    if (diff < 0) {
+        DPRINTF(CacheComp, "Base%dDelta%d compression failed\n",
+            8 * sizeof(BaseType), DeltaSizeBits);
+        return this->blkSize * 8;
+    }
+    return num_bases * size_x + num_m * size_m + 8 * sizeof(BaseType) * diff;
+}
+
 } // namespace compression
 } // namespace gem5
 
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/stats/info.hh"
+#include "base/types.hh"
+#include "mem/cache/compressors/base_delta.hh"
+#include "mem/cache/compressors/repeated_qwords.hh"
+#include "mem/cache/compressors/zero.hh"
+#include "params/Base16Delta8.hh"
+#include "params/Base32Delta16.hh"
+#include "params/Base32Delta8.hh"
+#include "params/Base64Delta16.hh"
+#include "params/Base64Delta32.hh"
+#include "params/Base64Delta8.hh"
+#include "params/RepeatedQwordsCompressor.hh"
+#include "params/ZeroCompressor.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const unsigned blkSize = 64;
+const unsigned numQwords = blkSize / sizeof(uint64_t);
+
+typedef std::vector<uint64_t> Line;
+
+/**
+ * Fill the parameters of a compressor the same way for all of them. The
+ * size threshold is disabled, so that the sizes are compared as given
+ * by the compressors.
+ */
+template <class Params>
+Params
+makeParams(unsigned chunk_size_bits, unsigned memo_entries = 0)
+{
+    Params p;
+    p.name = "compressor";
+    p.eventq_index = 0;
+    p.block_size = blkSize;
+    p.chunk_size_bits = chunk_size_bits;
+    p.size_threshold_percentage = 100;
+    p.comp_chunks_per_cycle = blkSize * 8 / chunk_size_bits;
+    p.comp_extra_latency = Cycles(0);
+    p.decomp_chunks_per_cycle = blkSize * 8 / chunk_size_bits;
+    p.decomp_extra_latency = Cycles(0);
+    p.memo_entries = memo_entries;
+    p.dictionary_size = blkSize;
+    return p;
+}
+
+/** Lines covering the cases handled by the fast paths. */
+std::vector<Line>
+representativeLines()
+{
+    std::vector<Line> lines;
+
+    // All zeros
+    lines.emplace_back(numQwords, 0);
+
+    // A single non-zero qword
+    lines.emplace_back(numQwords, 0);
+    lines.back()[5] = 0x1234;
+
+    // The same qword repeated, then all but the last one
+    lines.emplace_back(numQwords, 0xdeadbeefcafef00dULL);
+    lines.emplace_back(numQwords, 0xdeadbeefcafef00dULL);
+    lines.back()[numQwords - 1] = 0xdeadbeefcafef00eULL;
+
+    // Small values, close to the zero base
+    Line small(numQwords);
+    for (unsigned i = 0; i < numQwords; i++) {
+        small[i] = i * 3;
+    }
+    lines.push_back(small);
+
+    // Small deltas from one non-zero base, mixed with small values
+    Line one_base(numQwords);
+    for (unsigned i = 0; i < numQwords; i++) {
+        one_base[i] = (i % 3) ? 0x7f0012340000ULL + i : i;
+    }
+    lines.push_back(one_base);
+
+    // Small deltas from two interleaved bases
+    Line two_bases(numQwords);
+    for (unsigned i = 0; i < numQwords; i++) {
+        two_bases[i] = ((i % 2) ? 0x100000000000ULL : 0x200000000000ULL) +
+            i * 0x10;
+    }
+    lines.push_back(two_bases);
+
+    // Pointers a few kB apart, beyond the small deltas
+    Line pointers(numQwords);
+    for (unsigned i = 0; i < numQwords; i++) {
+        pointers[i] = 0x7ffff7a00000ULL + i * 0x1100;
+    }
+    lines.push_back(pointers);
+
+    // Values with no structure
+    Line random(numQwords);
+    uint64_t value = 0x9e3779b97f4a7c15ULL;
+    for (unsigned i = 0; i < numQwords; i++) {
+        value ^= value << 13;
+        value ^= value >> 7;
+        value ^= value << 17;
+        random[i] = value;
+    }
+    lines.push_back(random);
+
+    return lines;
+}
+
+/**
+ * Check that the compressed size, and the latencies, given by the fast
+ * size path of a compressor match the ones of its full compression.
+ */
+template <class Compressor>
+void
+checkSizes(unsigned chunk_size_bits, unsigned memo_entries = 0)
+{
+    Compressor compressor(makeParams<typename Compressor::Params>(
+        chunk_size_bits, memo_entries));
+    compressor.regStats();
+
+    // The compressors hide the interface used by the cache
+    compression::Base &base = compressor;
+
+    for (const auto &line : representativeLines()) {
+        Cycles comp_lat, decomp_lat;
+        const std::size_t size_bits = base.compress(line.data(),
+            comp_lat, decomp_lat)->getSizeBits();
+
+        // Twice, to also go through the memoized result if enabled
+        for (int i = 0; i < 2; i++) {
+            Cycles fast_comp_lat, fast_decomp_lat;
+            EXPECT_EQ(size_bits, base.compressedSizeBits(line.data(),
+                fast_comp_lat, fast_decomp_lat));
+            EXPECT_EQ(comp_lat, fast_comp_lat);
+            EXPECT_EQ(decomp_lat, fast_decomp_lat);
+        }
+    }
+}
+
+/**
+ * Get the pattern counts of a compressor after getting the compressed
+ * size of every representative line twice.
+ */
+template <class Compressor>
+statistics::VCounter
+patternCounts(unsigned chunk_size_bits, unsigned memo_entries)
+{
+    Compressor compressor(makeParams<typename Compressor::Params>(
+        chunk_size_bits, memo_entries));
+    compressor.regStats();
+    compression::Base &base = compressor;
+
+    for (int i = 0; i < 2; i++) {
+        for (const auto &line : representativeLines()) {
+            Cycles comp_lat, decomp_lat;
+            base.compressedSizeBits(line.data(), comp_lat, decomp_lat);
+        }
+    }
+
+    auto info = dynamic_cast<const statistics::VectorInfo *>(
+        compressor.resolveStat("patterns"));
+    assert(info);
+    return info->value();
+}
+
+} // anonymous namespace
+
+TEST(CompressedSizeTest, Zero)
+{
+    checkSizes<compression::Zero>(64);
+}
+
+TEST(CompressedSizeTest, RepeatedQwords)
+{
+    checkSizes<compression::RepeatedQwords>(64);
+}
+
+TEST(CompressedSizeTest, Base64Delta)
+{
+    checkSizes<compression::Base64Delta8>(64);
+    checkSizes<compression::Base64Delta16>(64);
+    checkSizes<compression::Base64Delta32>(64);
+}
+
+TEST(CompressedSizeTest, Base32Delta)
+{
+    checkSizes<compression::Base32Delta8>(32);
+    checkSizes<compression::Base32Delta16>(32);
+}
+
+TEST(CompressedSizeTest, Base16Delta)
+{
+    checkSizes<compression::Base16Delta8>(16);
+}
+
+/** Memoized sizes must match the ones that were computed. */
+TEST(CompressedSizeTest, Memoized)
+{
+    checkSizes<compression::Zero>(64, 16);
+    checkSizes<compression::Base64Delta8>(64, 16);
+    checkSizes<compression::Base32Delta16>(32, 1);
+}
+
+/** Memo hits count in the patterns as the compressions they replace. */
+TEST(CompressedSizeTest, MemoizedPatterns)
+{
+    EXPECT_EQ(patternCounts<compression::Zero>(64, 0),
+              patternCounts<compression::Zero>(64, 16));
+    EXPECT_EQ(patternCounts<compression::RepeatedQwords>(64, 0),
+              patternCounts<compression::RepeatedQwords>(64, 16));
+    EXPECT_EQ(patternCounts<compression::Base64Delta8>(64, 0),
+              patternCounts<compression::Base64Delta8>(64, 16));
+    EXPECT_EQ(patternCounts<compression::Base32Delta16>(32, 0),
+              patternCounts<compression::Base32Delta16>(32, 1));
+}
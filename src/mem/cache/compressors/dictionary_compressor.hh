@@ -101,6 +101,12 @@ class BaseDictionaryCompressor : public Base
      */
     virtual std::string getName(int number) const = 0;
 
+    statistics::Vector *
+    memoizedStat() override
+    {
+        return &dictionaryStats.patterns;
+    }
+
   public:
     typedef BaseDictionaryCompressorParams Params;
     BaseDictionaryCompressor(const Params &p);
@@ -189,6 +189,9 @@ class FrequentValues : public Base
     void probeNotify(const DataUpdate &data_update);
 
     void regProbeListeners() override;
+
+    /** The codes depend on the values seen so far. */
+    bool isMemoizable() const override { return false; }
 };
 
 class FrequentValues::CompData : public CompressionData
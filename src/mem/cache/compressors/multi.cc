@@ -86,6 +86,17 @@ Multi::setCache(BaseCache *_cache)
     }
 }
 
+bool
+Multi::isMemoizable() const
+{
+    for (const auto& compressor : compressors) {
+        if (!compressor->isMemoizable()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<Base::CompressionData>
 Multi::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
@@ -81,5 +81,46 @@ RepeatedQwords::compress(const std::vector<Chunk>& chunks,
     return comp_data;
 }
 
+std::size_t
+RepeatedQwords::compressedSizeBits(const std::vector<Chunk>& chunks,
+    Cycles& comp_lat, Cycles& decomp_lat)
+{
+    static const std::size_t size_x =
+        PatternX(toDictionaryEntry(0), -1).getSizeBits();
+    static const std::size_t size_m =
+        PatternM(toDictionaryEntry(0), 0).getSizeBits();
+
+    // Compare all entries against the first one without branching, so
+    // that the comparisons can be vectorized
+    assert(!chunks.empty());
+    std::size_t num_repeated = 0;
+    for (const auto& chunk : chunks) {
+        num_repeated += (chunk == chunks[0]);
+    }
+
+    // Every distinct value would be allocated a dictionary entry
+    std::size_t num_x = 1;
+    if (num_repeated < chunks.size()) {
+        for (std::size_t i = 1; i < chunks.size(); i++) {
+            bool seen = false;
+            for (std::size_t j = 0; j < i; j++) {
+                seen |= (chunks[j] == chunks[i]);
+            }
+            num_x += !seen;
+        }
+    }
+    dictionaryStats.patterns[X] += num_x;
+    dictionaryStats.patterns[M] += chunks.size() - num_x;
+
+    comp_lat = Cycles(1);
+    decomp_lat = Cycles(1);
+
+    if (num_x > 1) {
+        DPRINTF(CacheComp, "Repeated qwords compression failed\n");
+        return blkSize * 8;
+    }
+    return size_x + (chunks.size() - 1) * size_m;
+}
+
 } // namespace compression
 } // namespace gem5
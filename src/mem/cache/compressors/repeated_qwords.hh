@@ -100,6 +100,9 @@ class RepeatedQwords : public DictionaryCompressor<uint64_t>
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
 
+    std::size_t compressedSizeBits(const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
   public:
     typedef RepeatedQwordsCompressorParams Params;
     RepeatedQwords(const Params &p);
@@ -79,5 +79,32 @@ Zero::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     return comp_data;
 }
 
+std::size_t
+Zero::compressedSizeBits(const std::vector<Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    static const std::size_t size_z =
+        PatternZ(toDictionaryEntry(0), -1).getSizeBits();
+
+    // Count the zero entries without branching, so that the comparisons
+    // can be vectorized
+    std::size_t num_zeros = 0;
+    for (const auto& chunk : chunks) {
+        num_zeros += (chunk == 0);
+    }
+    dictionaryStats.patterns[Z] += num_zeros;
+    dictionaryStats.patterns[X] += chunks.size() - num_zeros;
+
+    comp_lat = Cycles(1);
+    decomp_lat = Cycles(1);
+
+    // If there is any non-zero entry, the compressor failed
+    if (num_zeros < chunks.size()) {
+        DPRINTF(CacheComp, "Zero compression failed\n");
+        return blkSize * 8;
+    }
+    return num_zeros * size_z;
+}
+
 } // namespace compression
 } // namespace gem5
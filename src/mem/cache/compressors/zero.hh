@@ -100,6 +100,9 @@ class Zero : public DictionaryCompressor<uint64_t>
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
 
+    std::size_t compressedSizeBits(const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
   public:
     typedef ZeroCompressorParams Params;
     Zero(const Params &p);
@@ -59,12 +59,25 @@ class HWPProbeEvent(object):
                 )
 
 
+class HWPProbeEventRetiredLoads(HWPProbeEvent):
+    def register(self):
+        if self.obj:
+            for name in self.names:
+                self.prefetcher.getCCObject().addRetiredLoadProbe(
+                    self.obj.getCCObject(), name
+                )
+
+
 class BasePrefetcher(ClockedObject):
     type = "BasePrefetcher"
     abstract = True
     cxx_class = "gem5::prefetch::Base"
     cxx_header = "mem/cache/prefetch/base.hh"
-    cxx_exports = [PyBindMethod("addEventProbe"), PyBindMethod("addMMU")]
+    cxx_exports = [
+        PyBindMethod("addEventProbe"),
+        PyBindMethod("addRetiredLoadProbe"),
+        PyBindMethod("addMMU"),
+    ]
     sys = Param.System(Parent.any, "System this prefetcher belongs to")
 
     # Get the block size from the parent (system)
@@ -89,6 +102,16 @@ class BasePrefetcher(ClockedObject):
     page_bytes = Param.MemorySize(
         "4KiB", "Size of pages for virtual addresses"
     )
+    pollution_filter = Param.BloomFilterBase(
+        NULL,
+        "Filter of the blocks evicted by prefetches, used to count the "
+        "demand misses they cause. Pollution is not tracked if unset",
+    )
+    pollution_reset_interval = Param.Unsigned(
+        4096,
+        "Number of blocks evicted by prefetches after which the pollution "
+        "filter is cleared, never cleared if 0",
+    )
 
     def __init__(self, **kwargs):
         super().__init__(**kwargs)
@@ -114,6 +137,15 @@ class BasePrefetcher(ClockedObject):
             raise TypeError("probeNames must have at least one element")
         self.addEvent(HWPProbeEvent(self, simObj, *probeNames))
 
+    # Train on the loads committed by a CPU exposing the RetiredLoadAccess
+    # probe (O3) instead of on the, possibly wrong-path, cache accesses.
+    def listenFromProbeRetiredLoads(self, simObj):
+        if not isinstance(simObj, SimObject):
+            raise TypeError("argument must be of SimObject type")
+        self.addEvent(
+            HWPProbeEventRetiredLoads(self, simObj, "RetiredLoadAccess")
+        )
+
     def registerMMU(self, simObj):
         if not isinstance(simObj, SimObject):
             raise TypeError("argument must be a SimObject type")
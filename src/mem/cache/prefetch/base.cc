@@ -62,15 +62,13 @@ Base::PrefetchInfo::PrefetchInfo(PacketPtr pkt, Addr addr, bool miss)
   : address(addr), pc(pkt->req->hasPC() ? pkt->req->getPC() : 0),
     requestorId(pkt->req->requestorId()), validPC(pkt->req->hasPC()),
     secure(pkt->isSecure()), size(pkt->req->getSize()), write(pkt->isWrite()),
-    paddress(pkt->req->getPaddr()), cacheMiss(miss)
+    paddress(pkt->req->getPaddr()), cacheMiss(miss), data(nullptr)
 {
-    unsigned int req_size = pkt->req->getSize();
-    if (!write && miss) {
-        data = nullptr;
-    } else {
-        data = new uint8_t[req_size];
+    // Refer to the data of the packet rather than copying it, as the
+    // event is handled before the packet is released
+    if ((write || !miss) && pkt->hasData()) {
         Addr offset = pkt->req->getPaddr() - pkt->getAddr();
-        std::memcpy(data, &(pkt->getConstPtr<uint8_t>()[offset]), req_size);
+        data = pkt->getConstPtr<uint8_t>() + offset;
     }
 }
 
@@ -92,8 +90,25 @@ Base::PrefetchListener::notify(const PacketPtr &pkt)
     }
 }
 
+void
+Base::RetiredLoadListener::notify(const PacketPtr &pkt)
+{
+    parent.notifyRetiredLoad(pkt);
+
+    // retired loads do not go through the cache, so have it send the
+    // prefetches they queued, as it does after its own accesses
+    if (parent.cache) {
+        Tick next_pf_time = std::max(parent.nextPrefetchReadyTime(),
+                                     parent.cache->clockEdge());
+        if (next_pf_time != MaxTick) {
+            parent.cache->schedMemSideSendEvent(next_pf_time);
+        }
+    }
+}
+
 Base::Base(const BasePrefetcherParams &p)
-    : ClockedObject(p), listeners(), cache(nullptr), blkSize(p.block_size),
+    : ClockedObject(p), listeners(), retiredLoadListeners(),
+      listenToCache(true), cache(nullptr), blkSize(p.block_size),
       lBlkSize(floorLog2(blkSize)), onMiss(p.on_miss), onRead(p.on_read),
       onWrite(p.on_write), onData(p.on_data), onInst(p.on_inst),
       requestorId(p.sys->getRequestorId(this)),
@@ -101,8 +116,11 @@ Base::Base(const BasePrefetcherParams &p)
       prefetchOnAccess(p.prefetch_on_access),
       prefetchOnPfHit(p.prefetch_on_pf_hit),
       useVirtualAddresses(p.use_virtual_addresses),
-      prefetchStats(this), issuedPrefetches(0),
-      usefulPrefetches(0), mmu(nullptr)
+      trainOnRetiredLoads(false), prefetchStats(this), issuedPrefetches(0),
+      usefulPrefetches(0), mmu(nullptr),
+      pollutionFilter(p.pollution_filter),
+      pollutionResetInterval(p.pollution_reset_interval),
+      pollutionEvictions(0)
 {
 }
 
@@ -141,7 +159,13 @@ Base::StatGroup::StatGroup(statistics::Group *parent)
     ADD_STAT(pfHitInWB, statistics::units::Count::get(),
         "number of prefetches hit in the Write Buffer"),
     ADD_STAT(pfLate, statistics::units::Count::get(),
-        "number of late prefetches (hitting in cache, MSHR or WB)")
+        "number of late prefetches (hitting in cache, MSHR or WB)"),
+    ADD_STAT(pfUsefulTooLate, statistics::units::Count::get(),
+        "number of demands finding the prefetch of their block in flight"),
+    ADD_STAT(timeliness, statistics::units::Ratio::get(),
+        "fraction of the useful prefetches completed in time"),
+    ADD_STAT(pfPollution, statistics::units::Count::get(),
+        "number of demand misses on blocks evicted by prefetches")
 {
     using namespace statistics;
 
@@ -154,10 +178,15 @@ Base::StatGroup::StatGroup(statistics::Group *parent)
     coverage = pfUseful / (pfUseful + demandMshrMisses);
 
     pfLate = pfHitInCache + pfHitInMSHR + pfHitInWB;
+
+    timeliness.flags(total);
+    timeliness = pfUseful / (pfUseful + pfUsefulTooLate);
+
+    pfPollution.flags(nozero);
 }
 
 bool
-Base::observeAccess(const PacketPtr &pkt, bool miss) const
+Base::observeAccess(const PacketPtr &pkt, bool miss, bool prefetched) const
 {
     bool fetch = pkt->req->isInstFetch();
     bool read = pkt->isRead();
@@ -165,7 +194,7 @@ Base::observeAccess(const PacketPtr &pkt, bool miss) const
 
     if (!miss) {
         if (prefetchOnPfHit)
-            return hasBeenPrefetched(pkt->getAddr(), pkt->isSecure());
+            return prefetched;
         if (!prefetchOnAccess)
             return false;
     }
@@ -250,7 +279,14 @@ Base::probeNotify(const PacketPtr &pkt, bool miss)
         panic("Request must have a physical address");
     }
 
-    if (hasBeenPrefetched(pkt->getAddr(), pkt->isSecure())) {
+    notifyAccess(pkt, miss, hasBeenPrefetched(pkt->getAddr(),
+                                              pkt->isSecure()));
+}
+
+void
+Base::notifyAccess(const PacketPtr &pkt, bool miss, bool prefetched)
+{
+    if (prefetched) {
         usefulPrefetches += 1;
         prefetchStats.pfUseful++;
         if (miss)
@@ -259,8 +295,12 @@ Base::probeNotify(const PacketPtr &pkt, bool miss)
             prefetchStats.pfUsefulButMiss++;
     }
 
+    // The accesses only account for the usefulness of the prefetches
+    // when training on the retired loads
+    if (trainOnRetiredLoads) return;
+
     // Verify this access type is observed by prefetcher
-    if (observeAccess(pkt, miss)) {
+    if (observeAccess(pkt, miss, prefetched)) {
         if (useVirtualAddresses && pkt->req->hasVaddr()) {
             PrefetchInfo pfi(pkt, pkt->req->getVaddr(), miss);
             notify(pkt, pfi);
@@ -271,6 +311,37 @@ Base::probeNotify(const PacketPtr &pkt, bool miss)
     }
 }
 
+void
+Base::notifyRetiredLoad(const PacketPtr &pkt)
+{
+    if (!onData || pkt->req->isUncacheable()) return;
+
+    // Whether the load hit in the cache is not known at this point
+    if (useVirtualAddresses) {
+        PrefetchInfo pfi(pkt, pkt->req->getVaddr(), false);
+        notify(pkt, pfi);
+    } else {
+        PrefetchInfo pfi(pkt, pkt->req->getPaddr(), false);
+        notify(pkt, pfi);
+    }
+}
+
+void
+Base::warmup(const PacketPtr &pkt, bool miss)
+{
+    if (pkt->isWrite() && cache != nullptr && cache->coalesce()) return;
+
+    bool prefetched = !miss && prefetchOnPfHit &&
+        hasBeenPrefetched(pkt->getAddr(), pkt->isSecure());
+    if (observeAccess(pkt, miss, prefetched)) {
+        if (useVirtualAddresses && pkt->req->hasVaddr()) {
+            train(PrefetchInfo(pkt, pkt->req->getVaddr(), miss));
+        } else if (!useVirtualAddresses) {
+            train(PrefetchInfo(pkt, pkt->req->getPaddr(), miss));
+        }
+    }
+}
+
 void
 Base::regProbeListeners()
 {
@@ -279,7 +350,7 @@ Base::regProbeListeners()
      * parent cache using the probe "Miss". Also connect to "Hit", if the
      * cache is configured to prefetch on accesses.
      */
-    if (listeners.empty() && cache != nullptr) {
+    if (listeners.empty() && listenToCache && cache != nullptr) {
         ProbeManager *pm(cache->getProbeManager());
         listeners.push_back(new PrefetchListener(*this, pm, "Miss", false,
                                                 true));
@@ -297,6 +368,14 @@ Base::addEventProbe(SimObject *obj, const char *name)
     listeners.push_back(new PrefetchListener(*this, pm, name));
 }
 
+void
+Base::addRetiredLoadProbe(SimObject *obj, const char *name)
+{
+    ProbeManager *pm(obj->getProbeManager());
+    retiredLoadListeners.push_back(new RetiredLoadListener(*this, pm, name));
+    setTrainOnRetiredLoads();
+}
+
 void
 Base::addMMU(BaseMMU *m)
 {
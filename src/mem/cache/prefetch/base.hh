@@ -50,6 +50,7 @@
 
 #include "arch/generic/tlb.hh"
 #include "base/compiler.hh"
+#include "base/filters/base.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_blk.hh"
@@ -87,6 +88,26 @@ class Base : public ClockedObject
 
     std::vector<PrefetchListener *> listeners;
 
+    class RetiredLoadListener : public ProbeListenerArgBase<PacketPtr>
+    {
+      public:
+        RetiredLoadListener(Base &_parent, ProbeManager *pm,
+                            const std::string &name)
+            : ProbeListenerArgBase(pm, name), parent(_parent) {}
+        void notify(const PacketPtr &pkt) override;
+      protected:
+        Base &parent;
+    };
+
+    std::vector<RetiredLoadListener *> retiredLoadListeners;
+
+    /**
+     * Whether the default listeners on the probes of the parent cache
+     * are registered. They are not when another prefetcher delivers the
+     * cache accesses to this one.
+     */
+    bool listenToCache;
+
   public:
 
     /**
@@ -113,8 +134,12 @@ class Base : public ClockedObject
         Addr paddress;
         /** Whether this event comes from a cache miss */
         bool cacheMiss;
-        /** Pointer to the associated request data */
-        uint8_t *data;
+        /**
+         * Pointer to the associated request data. It points into the
+         * packet that triggered the event, so it is only valid while the
+         * event is being handled.
+         */
+        const uint8_t *data;
 
       public:
         /**
@@ -214,10 +239,10 @@ class Base : public ClockedObject
             }
             switch (endian) {
                 case ByteOrder::big:
-                    return betoh(*(T*)data);
+                    return betoh(*(const T*)data);
 
                 case ByteOrder::little:
-                    return letoh(*(T*)data);
+                    return letoh(*(const T*)data);
 
                 default:
                     panic("Illegal byte order in PrefetchInfo::get()\n");
@@ -251,11 +276,6 @@ class Base : public ClockedObject
          * @param addr the address value of the new object
          */
         PrefetchInfo(PrefetchInfo const &pfi, Addr addr);
-
-        ~PrefetchInfo()
-        {
-            delete[] data;
-        }
     };
 
   protected:
@@ -300,12 +320,20 @@ class Base : public ClockedObject
     /** Use Virtual Addresses for prefetching */
     const bool useVirtualAddresses;
 
+    /**
+     * Train on the loads retired by the CPU rather than on the accesses
+     * of the cache. Set when a retired load probe is registered.
+     */
+    bool trainOnRetiredLoads;
+
     /**
      * Determine if this access should be observed
      * @param pkt The memory request causing the event
      * @param miss whether this event comes from a cache miss
+     * @param prefetched whether the access hits a prefetched block
      */
-    bool observeAccess(const PacketPtr &pkt, bool miss) const;
+    bool observeAccess(const PacketPtr &pkt, bool miss,
+                       bool prefetched) const;
 
     /** Determine if address is in cache */
     bool inCache(Addr addr, bool is_secure) const;
@@ -356,6 +384,16 @@ class Base : public ClockedObject
         /** The number of times a HW-prefetch is late
          * (hit in cache, MSHR, WB). */
         statistics::Formula pfLate;
+
+        /** The number of demand accesses that found the prefetch of
+         * their block still in flight. */
+        statistics::Scalar pfUsefulTooLate;
+        /** Fraction of the useful prefetches that completed in time. */
+        statistics::Formula timeliness;
+
+        /** The number of demand misses on blocks that were evicted to
+         * make room for a prefetched block. */
+        statistics::Scalar pfPollution;
     } prefetchStats;
 
     /** Total prefetches issued */
@@ -366,6 +404,19 @@ class Base : public ClockedObject
     /** Registered mmu for address translations */
     BaseMMU * mmu;
 
+    /**
+     * Blocks evicted by prefetches, used to estimate the pollution of
+     * the cache. Pollution is not tracked if there is no filter.
+     */
+    bloom_filter::Base *pollutionFilter;
+
+    /**
+     * Number of blocks evicted by prefetches after which the pollution
+     * filter is cleared, and number recorded since it last was.
+     */
+    const unsigned pollutionResetInterval;
+    unsigned pollutionEvictions;
+
   public:
     Base(const BasePrefetcherParams &p);
     virtual ~Base() = default;
@@ -382,6 +433,51 @@ class Base : public ClockedObject
     virtual void notifyFill(const PacketPtr &pkt)
     {}
 
+    /**
+     * Process an access of the parent cache once the checks that do not
+     * depend on the prefetcher configuration are done. This is where
+     * prefetchers combining others hand the access to each of them, so
+     * that the work common to all of them is done only once.
+     * @param pkt The memory request causing the event
+     * @param miss whether this event comes from a cache miss
+     * @param prefetched whether the access hits a prefetched block
+     */
+    virtual void notifyAccess(const PacketPtr &pkt, bool miss,
+                              bool prefetched);
+
+    /**
+     * Process a load retired by the CPU.
+     * @param pkt A packet describing the access of the load
+     */
+    virtual void notifyRetiredLoad(const PacketPtr &pkt);
+
+    /**
+     * Have the accesses of the parent cache delivered by another
+     * prefetcher through notifyAccess() and notifyFill(), instead of
+     * listening to the probes of the cache.
+     */
+    void
+    disableCacheListeners()
+    {
+        listenToCache = false;
+    }
+
+    /** Train on retired loads rather than on the cache accesses. */
+    virtual void
+    setTrainOnRetiredLoads()
+    {
+        trainOnRetiredLoads = true;
+    }
+
+    /**
+     * Train the prefetcher with an access of a functional warming stream.
+     * This updates the prefetcher state as a demand access would, but
+     * does not generate any prefetch.
+     * @param pkt The access, holding the data of the block
+     * @param miss whether the access missed in the cache
+     */
+    virtual void warmup(const PacketPtr &pkt, bool miss);
+
     virtual PacketPtr getPacket() = 0;
 
     virtual Tick nextPrefetchReadyTime() const = 0;
@@ -392,10 +488,46 @@ class Base : public ClockedObject
         prefetchStats.pfUnused++;
     }
 
+    /**
+     * Account for a demand miss.
+     * @param blk_addr The address of the missing block
+     */
     void
-    incrDemandMhsrMisses()
+    incrDemandMhsrMisses(Addr blk_addr)
     {
         prefetchStats.demandMshrMisses++;
+        if (pollutionFilter && pollutionFilter->isSet(blk_addr)) {
+            prefetchStats.pfPollution++;
+        }
+    }
+
+    /** A demand access found the prefetch of its block in flight. */
+    void
+    prefetchTooLate()
+    {
+        prefetchStats.pfUsefulTooLate++;
+    }
+
+    /**
+     * A block was evicted to make room for a prefetched block.
+     * @param blk_addr The address of the evicted block
+     */
+    void
+    prefetchEvicted(Addr blk_addr)
+    {
+        if (!pollutionFilter) {
+            return;
+        }
+
+        // a Bloom filter cannot drop a block without possibly dropping
+        // others that alias with it, so the whole filter is cleared
+        // once in a while instead, forgetting the old evictions
+        if (pollutionResetInterval &&
+            ++pollutionEvictions > pollutionResetInterval) {
+            pollutionFilter->clear();
+            pollutionEvictions = 1;
+        }
+        pollutionFilter->set(blk_addr);
     }
 
     void
@@ -421,6 +553,13 @@ class Base : public ClockedObject
      */
     void regProbeListeners() override;
 
+    /**
+     * Update the prefetcher state with an access, discarding any
+     * prefetch it would generate.
+     * @param pfi The access to train with
+     */
+    virtual void train(const PrefetchInfo &pfi) {}
+
     /**
      * Process a notification event from the ProbeListener.
      * @param pkt The memory request causing the event
@@ -435,6 +574,15 @@ class Base : public ClockedObject
      */
     void addEventProbe(SimObject *obj, const char *name);
 
+    /**
+     * Train on the loads notified by a probe of a CPU instead of on the
+     * accesses of the cache. The accesses of the cache are still used to
+     * track the usefulness of the prefetches.
+     * @param obj The SimObject pointer to listen from
+     * @param name The probe name
+     */
+    void addRetiredLoadProbe(SimObject *obj, const char *name);
+
     /**
      * Add a BaseMMU object to be used whenever a translation is needed.
      * This is generally required when the prefetcher is allowed to generate
@@ -55,8 +55,40 @@ Multi::Multi(const MultiPrefetcherParams &p)
 void
 Multi::setCache(BaseCache *_cache)
 {
-    for (auto pf : prefetchers)
+    Base::setCache(_cache);
+    for (auto pf : prefetchers) {
         pf->setCache(_cache);
+        pf->disableCacheListeners();
+    }
+}
+
+void
+Multi::notifyFill(const PacketPtr &pkt)
+{
+    for (auto pf : prefetchers)
+        pf->notifyFill(pkt);
+}
+
+void
+Multi::notifyAccess(const PacketPtr &pkt, bool miss, bool prefetched)
+{
+    for (auto pf : prefetchers)
+        pf->notifyAccess(pkt, miss, prefetched);
+}
+
+void
+Multi::notifyRetiredLoad(const PacketPtr &pkt)
+{
+    for (auto pf : prefetchers)
+        pf->notifyRetiredLoad(pkt);
+}
+
+void
+Multi::setTrainOnRetiredLoads()
+{
+    Base::setTrainOnRetiredLoads();
+    for (auto pf : prefetchers)
+        pf->setTrainOnRetiredLoads();
 }
 
 Tick
@@ -70,6 +102,13 @@ Multi::nextPrefetchReadyTime() const
     return next_ready;
 }
 
+void
+Multi::warmup(const PacketPtr &pkt, bool miss)
+{
+    for (auto pf : prefetchers)
+        pf->warmup(pkt, miss);
+}
+
 PacketPtr
 Multi::getPacket()
 {
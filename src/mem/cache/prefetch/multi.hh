@@ -60,15 +60,30 @@ class Multi : public Base
     PacketPtr getPacket() override;
     Tick nextPrefetchReadyTime() const override;
 
-    /** @{ */
     /**
-     * Ignore notifications since each sub-prefetcher already gets a
-     * notification through their probes-based interface.
+     * Ignore notifications since each sub-prefetcher builds its own
+     * prefetch information from the accesses handed to it.
      */
     void notify(const PacketPtr &pkt, const PrefetchInfo &pfi) override {};
-    void notifyFill(const PacketPtr &pkt) override {};
+
+    /** @{ */
+    /**
+     * The sub-prefetchers do not listen to the probes of the cache;
+     * the accesses are delivered once to this prefetcher, which hands
+     * them to each sub-prefetcher in turn.
+     */
+    void notifyFill(const PacketPtr &pkt) override;
+    void notifyAccess(const PacketPtr &pkt, bool miss,
+                      bool prefetched) override;
+    void notifyRetiredLoad(const PacketPtr &pkt) override;
     /** @} */
 
+    /** All the sub-prefetchers train on the retired loads. */
+    void setTrainOnRetiredLoads() override;
+
+    /** Each sub-prefetcher is trained with the warming accesses. */
+    void warmup(const PacketPtr &pkt, bool miss) override;
+
   protected:
     /** List of sub-prefetchers ordered by priority. */
     std::vector<Base*> prefetchers;
@@ -116,6 +116,30 @@ Queued::~Queued()
     }
 }
 
+Queued::iterator
+Queued::insertDeferred(std::list<DeferredPacket> &queue, iterator pos,
+                       const DeferredPacket &dpp)
+{
+    if (freeDeferred.empty()) {
+        return queue.insert(pos, dpp);
+    }
+    iterator node = freeDeferred.begin();
+    *node = dpp;
+    queue.splice(pos, freeDeferred, node);
+    return node;
+}
+
+Queued::iterator
+Queued::eraseDeferred(std::list<DeferredPacket> &queue, iterator it)
+{
+    iterator next = std::next(it);
+    // Do not keep the translation request alive in the free list
+    it->translationRequest.reset();
+    it->pkt = nullptr;
+    freeDeferred.splice(freeDeferred.begin(), queue, it);
+    return next;
+}
+
 void
 Queued::printQueue(const std::list<DeferredPacket> &queue) const
 {
@@ -168,6 +192,13 @@ Queued::getMaxPermittedPrefetches(size_t total) const
     return max_pfs;
 }
 
+void
+Queued::train(const PrefetchInfo &pfi)
+{
+    candidates.clear();
+    calculatePrefetch(pfi, candidates);
+}
+
 void
 Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
 {
@@ -185,7 +216,7 @@ Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
                         itr->pfInfo.getAddr(),
                         blockAddress(itr->pfInfo.getAddr()));
                 delete itr->pkt;
-                itr = pfq.erase(itr);
+                itr = eraseDeferred(pfq, itr);
                 statsQueued.pfRemovedDemand++;
             } else {
                 ++itr;
@@ -194,15 +225,15 @@ Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
     }
 
     // Calculate prefetches given this access
-    std::vector<AddrPriority> addresses;
-    calculatePrefetch(pfi, addresses);
+    candidates.clear();
+    calculatePrefetch(pfi, candidates);
 
     // Get the maximu number of prefetches that we are allowed to generate
-    size_t max_pfs = getMaxPermittedPrefetches(addresses.size());
+    size_t max_pfs = getMaxPermittedPrefetches(candidates.size());
 
     // Queue up generated prefetches
     size_t num_pfs = 0;
-    for (AddrPriority& addr_prio : addresses) {
+    for (AddrPriority& addr_prio : candidates) {
 
         // Block align prefetch address
         addr_prio.first = blockAddress(addr_prio.first);
@@ -250,7 +281,7 @@ Queued::getPacket()
     }
 
     PacketPtr pkt = pfq.front().pkt;
-    pfq.pop_front();
+    eraseDeferred(pfq, pfq.begin());
 
     prefetchStats.pfIssued++;
     issuedPrefetches += 1;
@@ -331,7 +362,7 @@ Queued::translationComplete(DeferredPacket *dp, bool failed)
                 "prefetch request %#x \n", mmu->name(),
                 it->translationRequest->getVaddr());
     }
-    pfqMissingTranslation.erase(it);
+    eraseDeferred(pfqMissingTranslation, it);
 }
 
 bool
@@ -508,11 +539,11 @@ Queued::addToQueue(std::list<DeferredPacket> &queue,
         DPRINTF(HWPrefetch, "Prefetch queue full, removing lowest priority "
                             "oldest packet, addr: %#x\n",it->pfInfo.getAddr());
         delete it->pkt;
-        queue.erase(it);
+        eraseDeferred(queue, it);
     }
 
     if ((queue.size() == 0) || (dpp <= queue.back())) {
-        queue.emplace_back(dpp);
+        insertDeferred(queue, queue.end(), dpp);
     } else {
         iterator it = queue.end();
         do {
@@ -522,7 +553,7 @@ Queued::addToQueue(std::list<DeferredPacket> &queue,
          * or not */
         if (it == queue.begin() && dpp <= *it)
             it++;
-        queue.insert(it, dpp);
+        insertDeferred(queue, it, dpp);
     }
 
     if (debug::HWPrefetchQueue)
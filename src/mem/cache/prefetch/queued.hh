@@ -145,6 +145,13 @@ class Queued : public Base
     using const_iterator = std::list<DeferredPacket>::const_iterator;
     using iterator = std::list<DeferredPacket>::iterator;
 
+    /**
+     * Nodes removed from the queues, kept to be spliced back into them so
+     * that queueing a prefetch does not allocate memory. It never holds
+     * more nodes than both queues together.
+     */
+    std::list<DeferredPacket> freeDeferred;
+
     // PARAMETERS
 
     /** Maximum size of the prefetch queue */
@@ -194,6 +201,8 @@ class Queued : public Base
 
     void notify(const PacketPtr &pkt, const PrefetchInfo &pfi) override;
 
+    void train(const PrefetchInfo &pfi) override;
+
     void insert(const PacketPtr &pkt, PrefetchInfo &new_pfi, int32_t priority);
 
     virtual void calculatePrefetch(const PrefetchInfo &pfi,
@@ -209,6 +218,9 @@ class Queued : public Base
 
   private:
 
+    /** Scratch space for the candidates generated by an access. */
+    std::vector<AddrPriority> candidates;
+
     /**
      * Adds a DeferredPacket to the specified queue
      * @param queue selected queue to use
@@ -216,6 +228,26 @@ class Queued : public Base
      */
     void addToQueue(std::list<DeferredPacket> &queue, DeferredPacket &dpp);
 
+    /**
+     * Inserts a copy of a DeferredPacket in a queue, reusing a recycled
+     * node if there is one.
+     * @param queue selected queue to use
+     * @param pos position before which the packet is inserted
+     * @param dpp DeferredPacket to add
+     * @return iterator to the inserted packet
+     */
+    iterator insertDeferred(std::list<DeferredPacket> &queue, iterator pos,
+                            const DeferredPacket &dpp);
+
+    /**
+     * Removes a DeferredPacket from a queue, recycling its node. The
+     * memory packet it holds, if any, must have been dealt with.
+     * @param queue queue holding the packet
+     * @param it iterator to the packet to remove
+     * @return iterator to the packet following the removed one
+     */
+    iterator eraseDeferred(std::list<DeferredPacket> &queue, iterator it);
+
     /**
      * Starts the translations of the queued prefetches with a
      * missing translation. It performs a maximum specified number of
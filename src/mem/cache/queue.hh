@@ -48,6 +48,8 @@
 #include <cassert>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/named.hh"
@@ -101,6 +103,37 @@ class Queue : public Drainable, public Named
     /** Holds non allocated entries. */
     typename Entry::List freeList;
 
+    /**
+     * Index of the allocated entries by block address, so that lookups
+     * only have to look at the entries of a single block rather than
+     * walking the lists. The lists remain the reference for ordering.
+     */
+    std::unordered_multimap<Addr, Entry*> addrIndex;
+
+    /**
+     * Adds a newly allocated entry to the address index. Must be called
+     * once the block address of the entry is set.
+     */
+    void
+    addToIndex(Entry *entry)
+    {
+        addrIndex.emplace(entry->blkAddr, entry);
+    }
+
+    /** Removes an entry from the address index. */
+    void
+    removeFromIndex(Entry *entry)
+    {
+        auto range = addrIndex.equal_range(entry->blkAddr);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == entry) {
+                addrIndex.erase(it);
+                return;
+            }
+        }
+        panic("Entry missing from the address index.");
+    }
+
     typename Entry::Iterator addToReadyList(Entry* entry)
     {
         if (readyList.empty() ||
@@ -116,6 +149,38 @@ class Queue : public Drainable, public Named
         panic("Failed to add to ready list.");
     }
 
+    /**
+     * Reference implementation of findMatch(), walking the entries in
+     * allocation order.
+     */
+    Entry*
+    findMatchInList(Addr blk_addr, bool is_secure,
+                    bool ignore_uncacheable) const
+    {
+        for (const auto& entry : allocatedList) {
+            if (!(ignore_uncacheable && entry->isUncacheable()) &&
+                entry->matchBlockAddr(blk_addr, is_secure)) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Reference implementation of findPending(), walking the entries in
+     * ready list order.
+     */
+    Entry*
+    findPendingInList(const QueueEntry* entry) const
+    {
+        for (const auto& ready_entry : readyList) {
+            if (ready_entry->conflictAddr(entry)) {
+                return ready_entry;
+            }
+        }
+        return nullptr;
+    }
+
     /** The number of entries that are in service. */
     int _numInService;
 
@@ -140,6 +205,8 @@ class Queue : public Drainable, public Named
         for (int i = 0; i < numEntries; ++i) {
             freeList.push_back(&entries[i]);
         }
+        // never rehash, as the index cannot grow beyond the entries
+        addrIndex.reserve(numEntries);
     }
 
     bool isEmpty() const
@@ -168,7 +235,10 @@ class Queue : public Drainable, public Named
     Entry* findMatch(Addr blk_addr, bool is_secure,
                      bool ignore_uncacheable = true) const
     {
-        for (const auto& entry : allocatedList) {
+        Entry *match = nullptr;
+        auto range = addrIndex.equal_range(blk_addr);
+        for (auto it = range.first; it != range.second; ++it) {
+            Entry *entry = it->second;
             // we ignore any entries allocated for uncacheable
             // accesses and simply ignore them when matching, in the
             // cache we never check for matches when adding new
@@ -177,10 +247,16 @@ class Queue : public Drainable, public Named
             // serving an uncacheable access
             if (!(ignore_uncacheable && entry->isUncacheable()) &&
                 entry->matchBlockAddr(blk_addr, is_secure)) {
-                return entry;
+                if (match) {
+                    // several candidates, only the list knows which
+                    // one was allocated first
+                    return findMatchInList(blk_addr, is_secure,
+                                           ignore_uncacheable);
+                }
+                match = entry;
             }
         }
-        return nullptr;
+        return match;
     }
 
     bool trySatisfyFunctional(PacketPtr pkt)
@@ -206,12 +282,22 @@ class Queue : public Drainable, public Named
      */
     Entry* findPending(const QueueEntry* entry) const
     {
-        for (const auto& ready_entry : readyList) {
-            if (ready_entry->conflictAddr(entry)) {
-                return ready_entry;
+        Entry *match = nullptr;
+        auto range = addrIndex.equal_range(entry->blkAddr);
+        for (auto it = range.first; it != range.second; ++it) {
+            Entry *ready_entry = it->second;
+            // entries in service are no longer on the ready list
+            if (!ready_entry->inService &&
+                ready_entry->conflictAddr(entry)) {
+                if (match) {
+                    // several candidates, the earliest is the first one
+                    // on the ready list
+                    return findPendingInList(entry);
+                }
+                match = ready_entry;
             }
         }
-        return nullptr;
+        return match;
     }
 
     /**
@@ -241,6 +327,7 @@ class Queue : public Drainable, public Named
     deallocate(Entry *entry)
     {
         allocatedList.erase(entry->allocIter);
+        removeFromIndex(entry);
         freeList.push_front(entry);
         allocated--;
         if (entry->inService) {
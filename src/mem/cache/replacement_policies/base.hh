@@ -109,6 +109,33 @@ class Base : public SimObject
      * @return A shared pointer to the new replacement data.
      */
     virtual std::shared_ptr<ReplacementData> instantiateEntry() = 0;
+
+    /**
+     * Get the state of a replacement data entry, so that it can be saved
+     * in a checkpoint. Policies that do not provide it get their entries
+     * reset when restored.
+     *
+     * @param replacement_data Replacement data to be saved.
+     * @return The state of the entry.
+     */
+    virtual uint64_t
+    getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+    {
+        return 0;
+    }
+
+    /**
+     * Restore the state of a replacement data entry, previously obtained
+     * through getState(). The entry has been reset beforehand.
+     *
+     * @param replacement_data Replacement data to be restored.
+     * @param state The state of the entry.
+     */
+    virtual void
+    setState(const std::shared_ptr<ReplacementData>& replacement_data,
+             uint64_t state) const
+    {
+    }
 };
 
 } // namespace replacement_policy
@@ -147,5 +147,25 @@ BRRIP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new BRRIPReplData(numRRPVBits));
 }
 
+uint64_t
+BRRIP::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    std::shared_ptr<BRRIPReplData> casted_replacement_data =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    return (uint64_t(casted_replacement_data->rrpv) << 1) |
+        casted_replacement_data->valid;
+}
+
+void
+BRRIP::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+                uint64_t state) const
+{
+    std::shared_ptr<BRRIPReplData> casted_replacement_data =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    casted_replacement_data->valid = state & 1;
+    casted_replacement_data->rrpv.reset();
+    casted_replacement_data->rrpv += state >> 1;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
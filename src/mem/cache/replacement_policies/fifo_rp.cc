@@ -28,6 +28,7 @@
 
 #include "mem/cache/replacement_policies/fifo_rp.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -94,5 +95,23 @@ FIFO::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new FIFOReplData());
 }
 
+uint64_t
+FIFO::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<FIFOReplData>(
+        replacement_data)->tickInserted;
+}
+
+void
+FIFO::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+               uint64_t state) const
+{
+    std::static_pointer_cast<FIFOReplData>(
+        replacement_data)->tickInserted = state;
+
+    // Keep the insertion order of the entries inserted afterwards
+    timeTicks = std::max(timeTicks, Tick(state));
+}
+
 } // namespace replacement_policy
 } // namespace gem5
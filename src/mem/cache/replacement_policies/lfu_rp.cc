@@ -92,5 +92,20 @@ LFU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LFUReplData());
 }
 
+uint64_t
+LFU::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<LFUReplData>(
+        replacement_data)->refCount;
+}
+
+void
+LFU::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+              uint64_t state) const
+{
+    std::static_pointer_cast<LFUReplData>(
+        replacement_data)->refCount = state;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
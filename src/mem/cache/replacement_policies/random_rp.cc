@@ -95,5 +95,21 @@ Random::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new RandomReplData());
 }
 
+uint64_t
+Random::getState(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<RandomReplData>(
+        replacement_data)->valid;
+}
+
+void
+Random::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+                 uint64_t state) const
+{
+    std::static_pointer_cast<RandomReplData>(
+        replacement_data)->valid = state;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -80,6 +80,11 @@ class BaseTags(ClockedObject):
         Parent.cache_line_size, "Indexing entry size in bytes"
     )
 
+    # Get the partitioning of the cache from the parent (cache)
+    partition_manager = Param.PartitionManager(
+        Parent.partition_manager, "Partitioning of the cache"
+    )
+
 
 class BaseSetAssoc(BaseTags):
     type = "BaseSetAssoc"
@@ -62,6 +62,7 @@ BaseTags::BaseTags(const Params &p)
     : ClockedObject(p), blkSize(p.block_size), blkMask(blkSize - 1),
       size(p.size), lookupLatency(p.tag_latency),
       system(p.system), indexingPolicy(p.indexing_policy),
+      partitionManager(p.partition_manager),
       warmupBound((p.warmup_percentage/100.0) * (p.size / p.block_size)),
       warmedUp(false), numBlocks(p.size / p.block_size),
       dataBlks(new uint8_t[p.size]), // Allocate data storage in one big chunk
@@ -83,7 +84,7 @@ BaseTags::findBlock(Addr addr, bool is_secure) const
     Addr tag = extractTag(addr);
 
     // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
+    const std::vector<ReplaceableEntry*> &entries =
         indexingPolicy->getPossibleEntries(addr);
 
     // Search for block
@@ -110,6 +111,9 @@ BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     RequestorID requestor_id = pkt->req->requestorId();
     assert(requestor_id < system->maxRequestors());
     stats.occupancies[requestor_id]++;
+    if (partitionManager) {
+        partitionManager->notifyAcquire(requestor_id);
+    }
 
     // Insert block with tag, src requestor id and task id
     blk->insert(extractTag(pkt->getAddr()), pkt->isSecure(), requestor_id,
@@ -56,6 +56,7 @@
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
 #include "mem/packet.hh"
 #include "params/BaseTags.hh"
 #include "sim/clocked_object.hh"
@@ -88,6 +89,9 @@ class BaseTags : public ClockedObject
     /** Indexing policy */
     BaseIndexingPolicy *indexingPolicy;
 
+    /** Partitioning of the cache among its requestors, if any. */
+    partitioning_policy::PartitionManager *partitionManager;
+
     /**
      * The number of tags that need to be touched to meet the warmup
      * percentage.
@@ -257,6 +261,9 @@ class BaseTags : public ClockedObject
         assert(blk->isValid());
 
         stats.occupancies[blk->getSrcRequestorId()]--;
+        if (partitionManager) {
+            partitionManager->notifyRelease(blk->getSrcRequestorId());
+        }
         stats.totalRefs += blk->getRefCount();
         stats.sampledRefs++;
 
@@ -276,11 +283,15 @@ class BaseTags : public ClockedObject
      * @param is_secure True if the target memory space is secure.
      * @param size Size, in bits, of new block to allocate.
      * @param evict_blks Cache blocks to be evicted.
-     * @return Cache block to be replaced.
+     * @param requestor_id Requestor the new block is allocated for, which
+     *        decides its partition if the cache is partitioned.
+     * @return Cache block to be replaced, or nullptr if the partition of
+     *         the requestor may not replace any of the candidates.
      */
     virtual CacheBlk* findVictim(Addr addr, const bool is_secure,
                                  const std::size_t size,
-                                 std::vector<CacheBlk*>& evict_blks) = 0;
+                                 std::vector<CacheBlk*>& evict_blks,
+                                 RequestorID requestor_id) = 0;
 
     /**
      * Access block and update replacement data. May not succeed, in which case
@@ -328,6 +339,30 @@ class BaseTags : public ClockedObject
      */
     virtual Addr regenerateBlkAddr(const CacheBlk* blk) const = 0;
 
+    /**
+     * Get the replacement state of a block, to be saved in a checkpoint.
+     * Tags that do not provide it get their blocks restored with the
+     * replacement state of a newly inserted block.
+     *
+     * @param blk The block.
+     * @return The replacement state.
+     */
+    virtual uint64_t
+    getReplacementState(const CacheBlk *blk) const
+    {
+        return 0;
+    }
+
+    /**
+     * Restore the replacement state of a block inserted when restoring
+     * a checkpoint.
+     *
+     * @param blk The block.
+     * @param state The replacement state, as returned by
+     *        getReplacementState().
+     */
+    virtual void setReplacementState(CacheBlk *blk, uint64_t state) {}
+
     /**
      * Visit each block in the tags and apply a visitor
      *
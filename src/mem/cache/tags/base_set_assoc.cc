@@ -45,15 +45,21 @@
 
 #include "mem/cache/tags/base_set_assoc.hh"
 
+#include <algorithm>
 #include <string>
 
+#include "base/bitfield.hh"
 #include "base/intmath.hh"
+#include "mem/cache/tags/indexing_policies/set_associative.hh"
 
 namespace gem5
 {
 
 BaseSetAssoc::BaseSetAssoc(const Params &p)
     :BaseTags(p), allocAssoc(p.assoc), blks(p.size / p.block_size),
+     assoc(p.assoc),
+     packedLookup(dynamic_cast<SetAssociative*>(p.indexing_policy)),
+     packedTags(blks.size(), MaxAddr),
      sequentialAccess(p.sequential_access),
      replacementPolicy(p.replacement_policy)
 {
@@ -85,10 +91,49 @@ BaseSetAssoc::tagsInit()
     }
 }
 
+CacheBlk*
+BaseSetAssoc::findBlock(Addr addr, bool is_secure) const
+{
+    if (!packedLookup)
+        return BaseTags::findBlock(addr, is_secure);
+
+    const Addr tag = extractTag(addr);
+
+    // The entries are the ways of a single set, in way order
+    const std::vector<ReplaceableEntry*> &entries =
+        indexingPolicy->getPossibleEntries(addr);
+    const Addr *set_tags = &packedTags[entries.front()->getSet() * assoc];
+
+    // Compare up to 64 ways at a time into a bit mask. The compare loop
+    // has no early exit so that the compiler can vectorize it.
+    for (unsigned first_way = 0; first_way < assoc; first_way += 64) {
+        const unsigned num_ways = std::min(assoc - first_way, 64U);
+        uint64_t matches = 0;
+        for (unsigned way = 0; way < num_ways; way++) {
+            matches |= uint64_t(set_tags[first_way + way] == tag) << way;
+        }
+
+        // Confirm the candidates, which also checks the valid and secure
+        // bits
+        while (matches) {
+            const int way = first_way + findLsbSet(matches);
+            CacheBlk* blk = static_cast<CacheBlk*>(entries[way]);
+            if (blk->matchTag(tag, is_secure)) {
+                return blk;
+            }
+            matches &= matches - 1;
+        }
+    }
+
+    // Did not find block
+    return nullptr;
+}
+
 void
 BaseSetAssoc::invalidate(CacheBlk *blk)
 {
     BaseTags::invalidate(blk);
+    packedTags[blkIndex(blk)] = MaxAddr;
 
     // Decrease the number of tags in use
     stats.tagsInUse--;
@@ -101,6 +146,8 @@ void
 BaseSetAssoc::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
     BaseTags::moveBlock(src_blk, dest_blk);
+    packedTags[blkIndex(src_blk)] = MaxAddr;
+    packedTags[blkIndex(dest_blk)] = dest_blk->getTag();
 
     // Since the blocks were using different replacement data pointers,
     // we must touch the replacement data of the new entry, and invalidate
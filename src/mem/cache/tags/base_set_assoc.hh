@@ -81,12 +81,36 @@ class BaseSetAssoc : public BaseTags
     /** The cache blocks. */
     std::vector<CacheBlk> blks;
 
+    /** The associativity of the cache. */
+    const unsigned assoc;
+
+    /**
+     * Whether all the ways of an address are in the same set, as with the
+     * set associative indexing policy. The tags of the candidates are then
+     * contiguous in packedTags and can be compared in one pass.
+     */
+    const bool packedLookup;
+
+    /**
+     * Copy of the tags of all blocks, indexed like blks (set * assoc +
+     * way), so that a lookup reads the tags of a set from a few cache lines
+     * rather than from every CacheBlk. Invalid blocks hold MaxAddr. This is
+     * only a filter: a matching tag is confirmed against the block itself.
+     */
+    std::vector<Addr> packedTags;
+
     /** Whether tags and data are accessed sequentially. */
     const bool sequentialAccess;
 
     /** Replacement policy */
     replacement_policy::Base *replacementPolicy;
 
+    /**
+     * The replacement candidates a partition may replace. Kept across
+     * replacements to avoid allocations.
+     */
+    std::vector<ReplaceableEntry*> partitionCandidates;
+
   public:
     /** Convenience typedef. */
      typedef BaseSetAssocParams Params;
@@ -101,6 +125,17 @@ class BaseSetAssoc : public BaseTags
      */
     virtual ~BaseSetAssoc() {};
 
+    /**
+     * Finds the given address in the cache without updating replacement
+     * data. With the set associative indexing policy the packed tags of
+     * the set are compared instead of walking its blocks.
+     *
+     * @param addr The address to find.
+     * @param is_secure True if the target memory space is secure.
+     * @return Pointer to the cache block if found.
+     */
+    CacheBlk* findBlock(Addr addr, bool is_secure) const override;
+
     /**
      * Initialize blocks as CacheBlk instances.
      */
@@ -140,6 +175,12 @@ class BaseSetAssoc : public BaseTags
             stats.dataAccesses += allocAssoc;
         }
 
+        // The partitioning policies monitor all lookups
+        if (partitionManager) {
+            partitionManager->notifyAccess(pkt->req->requestorId(),
+                                           pkt->getAddr());
+        }
+
         // If a cache hit
         if (blk != nullptr) {
             // Update number of references to accessed block
@@ -163,19 +204,37 @@ class BaseSetAssoc : public BaseTags
      * @param is_secure True if the target memory space is secure.
      * @param size Size, in bits, of new block to allocate.
      * @param evict_blks Cache blocks to be evicted.
+     * @param requestor_id Requestor the new block is allocated for.
      * @return Cache block to be replaced.
      */
     CacheBlk* findVictim(Addr addr, const bool is_secure,
                          const std::size_t size,
-                         std::vector<CacheBlk*>& evict_blks) override
+                         std::vector<CacheBlk*>& evict_blks,
+                         RequestorID requestor_id) override
     {
         // Get possible entries to be victimized
-        const std::vector<ReplaceableEntry*> entries =
-            indexingPolicy->getPossibleEntries(addr);
+        const std::vector<ReplaceableEntry*> *entries =
+            &indexingPolicy->getPossibleEntries(addr);
+
+        // Only keep the entries the partition of the requestor may replace
+        if (partitionManager) {
+            partitionCandidates = *entries;
+            partitionManager->filterByPartition(partitionCandidates,
+                                                requestor_id);
+            if (partitionCandidates.empty()) {
+                return nullptr;
+            }
+            entries = &partitionCandidates;
+        }
 
         // Choose replacement victim from replacement candidates
         CacheBlk* victim = static_cast<CacheBlk*>(replacementPolicy->getVictim(
-                                entries));
+                                *entries));
+
+        if (partitionManager && victim->isValid()) {
+            partitionManager->notifyReplacement(victim->getSrcRequestorId(),
+                                                requestor_id);
+        }
 
         // There is only one eviction for this replacement
         evict_blks.push_back(victim);
@@ -193,6 +252,7 @@ class BaseSetAssoc : public BaseTags
     {
         // Insert block
         BaseTags::insertBlock(pkt, blk);
+        packedTags[blkIndex(blk)] = blk->getTag();
 
         // Increment tag counter
         stats.tagsInUse++;
@@ -203,6 +263,25 @@ class BaseSetAssoc : public BaseTags
 
     void moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) override;
 
+    uint64_t
+    getReplacementState(const CacheBlk *blk) const override
+    {
+        return replacementPolicy->getState(blk->replacementData);
+    }
+
+    void
+    setReplacementState(CacheBlk *blk, uint64_t state) override
+    {
+        replacementPolicy->setState(blk->replacementData, state);
+    }
+
+    /** Get the index of a block in blks and packedTags. */
+    std::size_t
+    blkIndex(const CacheBlk *blk) const
+    {
+        return blk - blks.data();
+    }
+
     /**
      * Limit the allocation for the cache ways.
      * @param ways The maximum number of ways available for replacement.
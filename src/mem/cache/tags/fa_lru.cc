@@ -74,6 +74,7 @@ FALRU::FALRU(const Params &p)
               blkSize);
     if (!isPowerOf2(size))
         fatal("Cache Size must be power of 2 for now");
+    fatal_if(partitionManager, "FALRU tags cannot be partitioned");
 
     blks = new FALRUBlk[numBlocks];
 }
@@ -191,7 +192,8 @@ FALRU::findBlockBySetAndWay(int set, int way) const
 
 CacheBlk*
 FALRU::findVictim(Addr addr, const bool is_secure, const std::size_t size,
-                  std::vector<CacheBlk*>& evict_blks)
+                  std::vector<CacheBlk*>& evict_blks,
+                  RequestorID requestor_id)
 {
     // The victim is always stored on the tail for the FALRU
     FALRUBlk* victim = tail;
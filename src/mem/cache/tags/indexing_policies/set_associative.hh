@@ -110,13 +110,14 @@ class SetAssociative : public BaseIndexingPolicy
      * Find all possible entries for insertion and replacement of an address.
      * Should be called immediately before ReplacementPolicy's findVictim()
      * not to break cache resizing.
-     * Returns entries in all ways belonging to the set of the address.
+     * Returns entries in all ways belonging to the set of the address, in
+     * way order.
      *
      * @param addr The addr to a find possible entries for.
      * @return The possible entries.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                     override;
+    const std::vector<ReplaceableEntry*>&
+    getPossibleEntries(const Addr addr) const override;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
@@ -0,0 +1,110 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import *
+
+
+class PartitionManager(SimObject):
+    type = "PartitionManager"
+    cxx_class = "gem5::partitioning_policy::PartitionManager"
+    cxx_header = "mem/cache/tags/partitioning_policies/partition_manager.hh"
+
+    system = Param.System(Parent.any, "System we belong to")
+
+    partitions = VectorParam.String(
+        [],
+        "Requestor names defining each partition, in partition id order. "
+        "A requestor belongs to the first partition whose name is either "
+        "its own name or one of its ancestors' (e.g., system.cpu0 holds "
+        "system.cpu0.data). Requestors matching no partition share an "
+        "unmanaged partition, which is not restricted.",
+    )
+
+    partitioning_policies = VectorParam.BasePartitioningPolicy(
+        [],
+        "Partitioning policies. An entry is a replacement candidate of a "
+        "partition only if all the policies allow it.",
+    )
+
+
+class BasePartitioningPolicy(SimObject):
+    type = "BasePartitioningPolicy"
+    abstract = True
+    cxx_class = "gem5::partitioning_policy::BasePartitioningPolicy"
+    cxx_header = "mem/cache/tags/partitioning_policies/base_pp.hh"
+
+
+class WayPartitioningPolicy(BasePartitioningPolicy):
+    type = "WayPartitioningPolicy"
+    cxx_class = "gem5::partitioning_policy::WayPartitioningPolicy"
+    cxx_header = "mem/cache/tags/partitioning_policies/way_pp.hh"
+
+    cxx_exports = [
+        PyBindMethod("setWayMask"),
+        PyBindMethod("getWayMask"),
+    ]
+
+    way_masks = VectorParam.UInt64(
+        [],
+        "Ways each partition may allocate into, as a bit mask, in partition "
+        "id order. Like the capacity bit masks of Intel CAT, masks may "
+        "overlap and can be changed at runtime with setWayMask(). "
+        "Partitions without a mask may use all ways.",
+    )
+
+
+class MaxCapacityPartitioningPolicy(BasePartitioningPolicy):
+    type = "MaxCapacityPartitioningPolicy"
+    cxx_class = "gem5::partitioning_policy::MaxCapacityPartitioningPolicy"
+    cxx_header = "mem/cache/tags/partitioning_policies/max_capacity_pp.hh"
+
+    cache_size = Param.MemorySize(Parent.size, "Size of the cache")
+    block_size = Param.Int(Parent.cache_line_size, "Block size in bytes")
+
+    capacities = VectorParam.Float(
+        [],
+        "Maximum fraction of the cache each partition may hold, in "
+        "partition id order. A partition at its capacity can only replace "
+        "its own blocks. Partitions without a capacity are not limited.",
+    )
+
+
+class UtilityPartitioningPolicy(WayPartitioningPolicy):
+    type = "UtilityPartitioningPolicy"
+    cxx_class = "gem5::partitioning_policy::UtilityPartitioningPolicy"
+    cxx_header = "mem/cache/tags/partitioning_policies/ucp_pp.hh"
+
+    cache_size = Param.MemorySize(Parent.size, "Size of the cache")
+    block_size = Param.Int(Parent.cache_line_size, "Block size in bytes")
+    assoc = Param.Unsigned(Parent.assoc, "Associativity of the cache")
+
+    sampled_sets = Param.Unsigned(
+        32, "Number of sets whose accesses feed the utility monitors"
+    )
+    epoch = Param.Latency("1ms", "Time between two repartitions")
+    min_ways = Param.Unsigned(1, "Minimum number of ways of a partition")
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_BASE_PP_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_BASE_PP_HH__
+
+#include <vector>
+
+#include "base/types.hh"
+#include "params/BasePartitioningPolicy.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class ReplaceableEntry;
+
+namespace partitioning_policy
+{
+
+class PartitionManager;
+
+/**
+ * A common base class of cache partitioning policy objects. A policy
+ * restricts which entries can be replaced to allocate a block of a
+ * given partition. The partitions are defined by the partition manager,
+ * which maps each requestor to a partition id.
+ */
+class BasePartitioningPolicy : public SimObject
+{
+  protected:
+    /** The manager this policy belongs to. */
+    PartitionManager *manager;
+
+  public:
+    typedef BasePartitioningPolicyParams Params;
+    BasePartitioningPolicy(const Params &p);
+    virtual ~BasePartitioningPolicy() = default;
+
+    /**
+     * Set the manager this policy belongs to. Called by the manager when
+     * it is built, so it can be used from init() onwards.
+     *
+     * @param _manager The partition manager.
+     */
+    void setPartitionManager(PartitionManager *_manager);
+
+    /**
+     * Remove the replacement candidates a partition may not replace.
+     *
+     * @param entries The replacement candidates.
+     * @param partition_id The partition of the block being allocated.
+     */
+    virtual void filterByPartition(std::vector<ReplaceableEntry*> &entries,
+                                   unsigned partition_id) const = 0;
+
+    /**
+     * Notify the policy of a lookup of the tags, be it a hit or a miss.
+     *
+     * @param partition_id The partition of the requestor.
+     * @param addr The address looked up.
+     */
+    virtual void notifyAccess(unsigned partition_id, Addr addr) {}
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_BASE_PP_HH__
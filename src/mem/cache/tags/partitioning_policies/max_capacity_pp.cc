@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/partitioning_policies/max_capacity_pp.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+#include "params/MaxCapacityPartitioningPolicy.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+MaxCapacityPartitioningPolicy::MaxCapacityPartitioningPolicy(
+    const Params &p)
+    : BasePartitioningPolicy(p), numBlocks(p.cache_size / p.block_size),
+      capacities(p.capacities)
+{
+    for (const double capacity : capacities) {
+        fatal_if(capacity <= 0 || capacity > 1, "%s: capacities must be "
+                 "fractions of the cache, in (0, 1].", name());
+    }
+}
+
+void
+MaxCapacityPartitioningPolicy::init()
+{
+    BasePartitioningPolicy::init();
+
+    fatal_if(!manager, "%s does not belong to a partition manager.",
+             name());
+    fatal_if(capacities.size() > manager->unmanagedPartition(),
+             "%s has more capacities than partitions.", name());
+
+    maxBlocks.assign(manager->unmanagedPartition(), numBlocks);
+    for (unsigned i = 0; i < capacities.size(); i++) {
+        maxBlocks[i] = std::max<uint64_t>(1, capacities[i] * numBlocks);
+    }
+}
+
+void
+MaxCapacityPartitioningPolicy::filterByPartition(
+    std::vector<ReplaceableEntry*> &entries, unsigned partition_id) const
+{
+    if (manager->getOccupancy(partition_id) < maxBlocks[partition_id]) {
+        return;
+    }
+
+    // The partition is full, so it can only replace its own blocks
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+        [this, partition_id](const ReplaceableEntry *entry) {
+            const CacheBlk *blk = static_cast<const CacheBlk*>(entry);
+            return !blk->isValid() || manager->getPartitionId(
+                blk->getSrcRequestorId()) != partition_id;
+        }), entries.end());
+}
+
+} // namespace partitioning_policy
+} // namespace gem5
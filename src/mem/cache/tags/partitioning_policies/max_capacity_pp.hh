@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_MAX_CAPACITY_PP_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_MAX_CAPACITY_PP_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "mem/cache/tags/partitioning_policies/base_pp.hh"
+
+namespace gem5
+{
+
+struct MaxCapacityPartitioningPolicyParams;
+
+namespace partitioning_policy
+{
+
+/**
+ * Limits the number of blocks each partition may hold in the whole cache.
+ * Once a partition reaches its capacity it may only replace its own
+ * blocks, wherever they are, so that it cannot grow any further.
+ */
+class MaxCapacityPartitioningPolicy : public BasePartitioningPolicy
+{
+  private:
+    /** Number of blocks of the cache. */
+    const uint64_t numBlocks;
+
+    /** The capacities given as parameters, as fractions of the cache. */
+    const std::vector<double> capacities;
+
+    /** Maximum number of blocks of each partition, set in init(). */
+    std::vector<uint64_t> maxBlocks;
+
+  public:
+    typedef MaxCapacityPartitioningPolicyParams Params;
+    MaxCapacityPartitioningPolicy(const Params &p);
+
+    void init() override;
+
+    void filterByPartition(std::vector<ReplaceableEntry*> &entries,
+                           unsigned partition_id) const override;
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_MAX_CAPACITY_PP_HH__
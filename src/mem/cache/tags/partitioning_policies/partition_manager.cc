@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+
+#include <cassert>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/CachePartitioning.hh"
+#include "mem/cache/tags/partitioning_policies/base_pp.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+PartitionManager::PartitionManager(const Params &p)
+    : SimObject(p), system(p.system), partitions(p.partitions),
+      policies(p.partitioning_policies),
+      occupancies(partitions.size() + 1, 0), stats(*this)
+{
+    fatal_if(partitions.empty(), "%s must define at least one partition.",
+             name());
+
+    for (auto policy : policies) {
+        policy->setPartitionManager(this);
+    }
+}
+
+unsigned
+PartitionManager::lookupPartition(RequestorID requestor_id)
+{
+    if (requestor_id >= system->maxRequestors()) {
+        return unmanagedPartition();
+    }
+
+    // Resolve the requestors registered since the last lookup
+    while (requestorPartitions.size() <= requestor_id) {
+        const std::string requestor_name =
+            system->getRequestorName(requestorPartitions.size());
+        unsigned partition_id = unmanagedPartition();
+        for (unsigned i = 0; i < partitions.size(); i++) {
+            const std::string &prefix = partitions[i];
+            if (requestor_name.compare(0, prefix.size(), prefix) == 0 &&
+                (requestor_name.size() == prefix.size() ||
+                 requestor_name[prefix.size()] == '.')) {
+                partition_id = i;
+                break;
+            }
+        }
+        DPRINTF(CachePartitioning, "Requestor %s is in partition %d\n",
+                requestor_name, partition_id);
+        requestorPartitions.push_back(partition_id);
+    }
+
+    return requestorPartitions[requestor_id];
+}
+
+void
+PartitionManager::filterByPartition(std::vector<ReplaceableEntry*> &entries,
+                                    RequestorID requestor_id)
+{
+    const unsigned partition_id = getPartitionId(requestor_id);
+    if (partition_id == unmanagedPartition()) {
+        return;
+    }
+
+    for (auto policy : policies) {
+        policy->filterByPartition(entries, partition_id);
+    }
+}
+
+void
+PartitionManager::notifyAccess(RequestorID requestor_id, Addr addr)
+{
+    const unsigned partition_id = getPartitionId(requestor_id);
+    for (auto policy : policies) {
+        policy->notifyAccess(partition_id, addr);
+    }
+}
+
+void
+PartitionManager::notifyAcquire(RequestorID requestor_id)
+{
+    const unsigned partition_id = getPartitionId(requestor_id);
+    occupancies[partition_id]++;
+    stats.occupancies[partition_id]++;
+    stats.allocations[partition_id]++;
+}
+
+void
+PartitionManager::notifyRelease(RequestorID requestor_id)
+{
+    const unsigned partition_id = getPartitionId(requestor_id);
+    assert(occupancies[partition_id] > 0);
+    occupancies[partition_id]--;
+    stats.occupancies[partition_id]--;
+}
+
+void
+PartitionManager::notifyReplacement(RequestorID victim_requestor_id,
+                                    RequestorID requestor_id)
+{
+    const unsigned victim_partition_id =
+        getPartitionId(victim_requestor_id);
+    if (victim_partition_id != getPartitionId(requestor_id)) {
+        stats.interferences[victim_partition_id]++;
+    }
+}
+
+PartitionManager::PartitionManagerStats::PartitionManagerStats(
+    PartitionManager &_manager)
+  : statistics::Group(&_manager), manager(_manager),
+    ADD_STAT(occupancies, statistics::units::Count::get(),
+             "Average number of blocks of each partition"),
+    ADD_STAT(allocations, statistics::units::Count::get(),
+             "Number of blocks of each partition allocated"),
+    ADD_STAT(interferences, statistics::units::Count::get(),
+             "Number of blocks of each partition replaced by another "
+             "partition")
+{
+}
+
+void
+PartitionManager::PartitionManagerStats::regStats()
+{
+    statistics::Group::regStats();
+
+    const unsigned num_partitions = manager.numPartitions();
+    occupancies.init(num_partitions);
+    allocations.init(num_partitions);
+    interferences.init(num_partitions);
+    for (unsigned i = 0; i < manager.partitions.size(); i++) {
+        occupancies.subname(i, manager.partitions[i]);
+        allocations.subname(i, manager.partitions[i]);
+        interferences.subname(i, manager.partitions[i]);
+    }
+    occupancies.subname(manager.unmanagedPartition(), "unmanaged");
+    allocations.subname(manager.unmanagedPartition(), "unmanaged");
+    interferences.subname(manager.unmanagedPartition(), "unmanaged");
+}
+
+} // namespace partitioning_policy
+} // namespace gem5
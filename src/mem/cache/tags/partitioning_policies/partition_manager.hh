@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_PARTITION_MANAGER_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_PARTITION_MANAGER_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/request.hh"
+#include "params/PartitionManager.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class ReplaceableEntry;
+class System;
+
+namespace partitioning_policy
+{
+
+class BasePartitioningPolicy;
+
+/**
+ * Divides the requestors sharing a cache into partitions, and applies
+ * the partitioning policies to the allocations of each partition. The
+ * partitions are identified by the requestor names given as parameters,
+ * in order; requestors that belong to none of them are put in an extra,
+ * unmanaged, partition, which the policies do not restrict.
+ */
+class PartitionManager : public SimObject
+{
+  private:
+    System *system;
+
+    /** The requestor name defining each managed partition. */
+    const std::vector<std::string> partitions;
+
+    /** The partitioning policies, all of which must allow a candidate. */
+    const std::vector<BasePartitioningPolicy*> policies;
+
+    /**
+     * Partition of each requestor, indexed by requestor id. It is filled
+     * in lazily, as requestors can be registered at any time.
+     */
+    std::vector<unsigned> requestorPartitions;
+
+    /** Number of blocks each partition currently holds. */
+    std::vector<uint64_t> occupancies;
+
+    /**
+     * Find the partition of a requestor from its name.
+     *
+     * @param requestor_id The requestor.
+     * @return The id of its partition.
+     */
+    unsigned lookupPartition(RequestorID requestor_id);
+
+    struct PartitionManagerStats : public statistics::Group
+    {
+        PartitionManagerStats(PartitionManager &manager);
+
+        void regStats() override;
+
+        const PartitionManager &manager;
+
+        /** Per tick average of the number of blocks of each partition. */
+        statistics::AverageVector occupancies;
+
+        /** Number of blocks of each partition allocated. */
+        statistics::Vector allocations;
+
+        /**
+         * Number of blocks of each partition replaced to allocate a block
+         * of another partition.
+         */
+        statistics::Vector interferences;
+    } stats;
+
+  public:
+    typedef PartitionManagerParams Params;
+    PartitionManager(const Params &p);
+
+    /**
+     * Get the number of partitions, including the unmanaged one.
+     *
+     * @return The number of partitions.
+     */
+    unsigned
+    numPartitions() const
+    {
+        return partitions.size() + 1;
+    }
+
+    /**
+     * Get the id of the partition of the requestors that belong to none
+     * of the managed partitions. It is the last partition id.
+     *
+     * @return The id of the unmanaged partition.
+     */
+    unsigned
+    unmanagedPartition() const
+    {
+        return partitions.size();
+    }
+
+    /**
+     * Get the partition of a requestor.
+     *
+     * @param requestor_id The requestor.
+     * @return The id of its partition.
+     */
+    unsigned
+    getPartitionId(RequestorID requestor_id)
+    {
+        if (requestor_id < requestorPartitions.size()) {
+            return requestorPartitions[requestor_id];
+        }
+        return lookupPartition(requestor_id);
+    }
+
+    /**
+     * Get the number of blocks a partition holds.
+     *
+     * @param partition_id The partition.
+     * @return Its number of blocks.
+     */
+    uint64_t
+    getOccupancy(unsigned partition_id) const
+    {
+        return occupancies[partition_id];
+    }
+
+    /**
+     * Remove the replacement candidates the partition of a requestor may
+     * not replace, according to all policies.
+     *
+     * @param entries The replacement candidates.
+     * @param requestor_id The requestor of the block being allocated.
+     */
+    void filterByPartition(std::vector<ReplaceableEntry*> &entries,
+                           RequestorID requestor_id);
+
+    /**
+     * Notify the policies of a lookup of the tags.
+     *
+     * @param requestor_id The requestor of the access.
+     * @param addr The address looked up.
+     */
+    void notifyAccess(RequestorID requestor_id, Addr addr);
+
+    /**
+     * Account for a block being allocated.
+     *
+     * @param requestor_id The requestor the block belongs to.
+     */
+    void notifyAcquire(RequestorID requestor_id);
+
+    /**
+     * Account for a block being invalidated.
+     *
+     * @param requestor_id The requestor the block belonged to.
+     */
+    void notifyRelease(RequestorID requestor_id);
+
+    /**
+     * Account for a valid block being chosen as a replacement victim.
+     *
+     * @param victim_requestor_id The requestor the victim belongs to.
+     * @param requestor_id The requestor of the block being allocated.
+     */
+    void notifyReplacement(RequestorID victim_requestor_id,
+                           RequestorID requestor_id);
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_PARTITION_MANAGER_HH__
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/partitioning_policies/ucp_pp.hh"
+
+#include <algorithm>
+
+#include "base/bitfield.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/CachePartitioning.hh"
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+#include "params/UtilityPartitioningPolicy.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+UtilityPartitioningPolicy::UtilityPartitioningPolicy(const Params &p)
+    : WayPartitioningPolicy(p), blkSize(p.block_size), assoc(p.assoc),
+      numSets(p.cache_size / (p.block_size * p.assoc)),
+      sampledSets(std::min(p.sampled_sets, numSets)),
+      samplingStride(numSets / std::max(sampledSets, 1U)),
+      epoch(p.epoch), minWays(p.min_ways), nextRepartition(MaxTick),
+      stats(*this)
+{
+    fatal_if(sampledSets == 0, "%s must monitor at least one set.",
+             name());
+    fatal_if(assoc > 64, "%s can only partition up to 64 ways.", name());
+    fatal_if(minWays == 0, "%s: partitions need at least one way.",
+             name());
+    fatal_if(epoch == 0, "%s: the epoch must not be empty.", name());
+}
+
+void
+UtilityPartitioningPolicy::init()
+{
+    WayPartitioningPolicy::init();
+
+    const unsigned num_partitions = manager->unmanagedPartition();
+    fatal_if(num_partitions * minWays > assoc, "%s: there are not enough "
+             "ways for %d partitions of at least %d ways.", name(),
+             num_partitions, minWays);
+
+    umonTags.assign(num_partitions * sampledSets * assoc, MaxAddr);
+    umonHits.assign(num_partitions * assoc, 0);
+}
+
+void
+UtilityPartitioningPolicy::startup()
+{
+    WayPartitioningPolicy::startup();
+
+    nextRepartition = curTick() + epoch;
+}
+
+void
+UtilityPartitioningPolicy::notifyAccess(unsigned partition_id, Addr addr)
+{
+    if (curTick() >= nextRepartition) {
+        repartition();
+        nextRepartition = curTick() + epoch;
+    }
+
+    if (partition_id >= manager->unmanagedPartition()) {
+        return;
+    }
+
+    const Addr blk_addr = addr / blkSize;
+    const unsigned set = blk_addr % numSets;
+    if (set % samplingStride) {
+        return;
+    }
+    const unsigned sample = set / samplingStride;
+    if (sample >= sampledSets) {
+        return;
+    }
+
+    // Update the LRU stack of the set as if the partition had all ways
+    Addr *stack = &umonTags[(partition_id * sampledSets + sample) * assoc];
+    Addr *entry = std::find(stack, stack + assoc, blk_addr);
+    if (entry != stack + assoc) {
+        umonHits[partition_id * assoc + (entry - stack)]++;
+        std::rotate(stack, entry, entry + 1);
+    } else {
+        std::rotate(stack, stack + assoc - 1, stack + assoc);
+        stack[0] = blk_addr;
+    }
+}
+
+void
+UtilityPartitioningPolicy::repartition()
+{
+    const unsigned num_partitions = manager->unmanagedPartition();
+
+    // Hits of each partition with n ways, for n in [0, assoc]
+    std::vector<uint64_t> utility(num_partitions * (assoc + 1), 0);
+    for (unsigned p = 0; p < num_partitions; p++) {
+        for (unsigned way = 0; way < assoc; way++) {
+            utility[p * (assoc + 1) + way + 1] =
+                utility[p * (assoc + 1) + way] + umonHits[p * assoc + way];
+        }
+    }
+
+    // Lookahead: repeatedly give the ways to the partition with the
+    // highest marginal utility, looking at every possible number of
+    // extra ways so that utility plateaus are not a dead end
+    std::vector<unsigned> allocation(num_partitions, minWays);
+    unsigned balance = assoc - num_partitions * minWays;
+    while (balance > 0) {
+        double best_utility = -1;
+        unsigned best_partition = 0;
+        unsigned best_ways = 1;
+        for (unsigned p = 0; p < num_partitions; p++) {
+            const uint64_t *partition_utility = &utility[p * (assoc + 1)];
+            const uint64_t current = partition_utility[allocation[p]];
+            for (unsigned ways = 1; ways <= balance; ways++) {
+                const double marginal_utility = double(
+                    partition_utility[allocation[p] + ways] - current) /
+                    ways;
+                if (marginal_utility > best_utility) {
+                    best_utility = marginal_utility;
+                    best_partition = p;
+                    best_ways = ways;
+                }
+            }
+        }
+        allocation[best_partition] += best_ways;
+        balance -= best_ways;
+    }
+
+    // Give each partition a contiguous range of ways
+    unsigned first_way = 0;
+    for (unsigned p = 0; p < num_partitions; p++) {
+        DPRINTF(CachePartitioning, "UCP gives %d ways to partition %d\n",
+                allocation[p], p);
+        setWayMask(p, mask(allocation[p]) << first_way);
+        first_way += allocation[p];
+    }
+
+    for (auto &hits : umonHits) {
+        hits /= 2;
+    }
+
+    stats.repartitions++;
+}
+
+UtilityPartitioningPolicy::UtilityPartitioningStats::
+UtilityPartitioningStats(UtilityPartitioningPolicy &policy)
+  : statistics::Group(&policy),
+    ADD_STAT(repartitions, statistics::units::Count::get(),
+             "Number of times the ways were distributed")
+{
+}
+
+} // namespace partitioning_policy
+} // namespace gem5
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UCP_PP_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UCP_PP_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/cache/tags/partitioning_policies/way_pp.hh"
+
+namespace gem5
+{
+
+struct UtilityPartitioningPolicyParams;
+
+namespace partitioning_policy
+{
+
+/**
+ * Utility-based cache partitioning, as proposed by Qureshi and Patt in
+ * "Utility-Based Cache Partitioning: A Low-Overhead, High-Performance,
+ * Runtime Mechanism to Partition Shared Caches" (MICRO 2006).
+ *
+ * A utility monitor per partition keeps the tags the partition would hold
+ * in a sample of the sets if it had the whole cache, as an LRU stack, and
+ * counts the hits at each stack position. The hits of the first n
+ * positions are the hits the partition would get with n ways. At the end
+ * of each epoch the ways are distributed with the lookahead algorithm,
+ * and each partition gets a contiguous range of ways as its way mask.
+ * The counters are then halved, so that recent behaviour weighs more.
+ */
+class UtilityPartitioningPolicy : public WayPartitioningPolicy
+{
+  private:
+    /** Block size of the cache. */
+    const unsigned blkSize;
+
+    /** Associativity of the cache. */
+    const unsigned assoc;
+
+    /** Number of sets of the cache. */
+    const unsigned numSets;
+
+    /** Number of sets monitored. */
+    const unsigned sampledSets;
+
+    /** One out of samplingStride sets is monitored. */
+    const unsigned samplingStride;
+
+    /** Time between two repartitions. */
+    const Tick epoch;
+
+    /** Minimum number of ways of a partition. */
+    const unsigned minWays;
+
+    /** When the ways will be distributed next. */
+    Tick nextRepartition;
+
+    /**
+     * The shadow tags of the utility monitors, as the block addresses of
+     * each monitored set of each partition, from MRU to LRU.
+     */
+    std::vector<Addr> umonTags;
+
+    /** Hits of each partition at each LRU stack position. */
+    std::vector<uint64_t> umonHits;
+
+    /** Distribute the ways among the partitions. */
+    void repartition();
+
+    struct UtilityPartitioningStats : public statistics::Group
+    {
+        UtilityPartitioningStats(UtilityPartitioningPolicy &policy);
+
+        /** Number of times the ways were distributed. */
+        statistics::Scalar repartitions;
+    } stats;
+
+  public:
+    typedef UtilityPartitioningPolicyParams Params;
+    UtilityPartitioningPolicy(const Params &p);
+
+    void init() override;
+    void startup() override;
+
+    void notifyAccess(unsigned partition_id, Addr addr) override;
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UCP_PP_HH__
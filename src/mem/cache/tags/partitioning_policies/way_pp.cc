@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/partitioning_policies/way_pp.hh"
+
+#include <algorithm>
+
+#include "base/bitfield.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/CachePartitioning.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+#include "params/WayPartitioningPolicy.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+WayPartitioningPolicy::WayPartitioningPolicy(const Params &p)
+    : BasePartitioningPolicy(p), initialWayMasks(p.way_masks)
+{
+}
+
+void
+WayPartitioningPolicy::init()
+{
+    BasePartitioningPolicy::init();
+
+    fatal_if(!manager, "%s does not belong to a partition manager.",
+             name());
+    fatal_if(initialWayMasks.size() > manager->unmanagedPartition(),
+             "%s has more way masks than partitions.", name());
+
+    wayMasks.assign(manager->unmanagedPartition(), ~uint64_t(0));
+    for (unsigned i = 0; i < initialWayMasks.size(); i++) {
+        setWayMask(i, initialWayMasks[i]);
+    }
+}
+
+void
+WayPartitioningPolicy::filterByPartition(
+    std::vector<ReplaceableEntry*> &entries, unsigned partition_id) const
+{
+    const uint64_t mask = wayMasks[partition_id];
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+        [mask](const ReplaceableEntry *entry) {
+            const uint32_t way = entry->getWay();
+            return (way < 64) && !bits(mask, way);
+        }), entries.end());
+}
+
+void
+WayPartitioningPolicy::setWayMask(unsigned partition_id, uint64_t mask)
+{
+    fatal_if(partition_id >= wayMasks.size(),
+             "%s: invalid partition %d.", name(), partition_id);
+    fatal_if(mask == 0, "%s: partition %d must have at least one way.",
+             name(), partition_id);
+
+    DPRINTF(CachePartitioning, "Way mask of partition %d set to %#x\n",
+            partition_id, mask);
+    wayMasks[partition_id] = mask;
+}
+
+uint64_t
+WayPartitioningPolicy::getWayMask(unsigned partition_id) const
+{
+    fatal_if(partition_id >= wayMasks.size(),
+             "%s: invalid partition %d.", name(), partition_id);
+    return wayMasks[partition_id];
+}
+
+} // namespace partitioning_policy
+} // namespace gem5
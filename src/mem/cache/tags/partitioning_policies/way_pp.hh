@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_WAY_PP_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_WAY_PP_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "mem/cache/tags/partitioning_policies/base_pp.hh"
+
+namespace gem5
+{
+
+struct WayPartitioningPolicyParams;
+
+namespace partitioning_policy
+{
+
+/**
+ * Way partitioning, where each partition may only allocate into the ways
+ * of its way mask. As with the capacity bit masks of Intel CAT, the masks
+ * may overlap and can be reprogrammed at runtime, in which case the blocks
+ * already in the cache stay where they are until they are replaced. Only
+ * the first 64 ways can be partitioned; the others are shared.
+ */
+class WayPartitioningPolicy : public BasePartitioningPolicy
+{
+  protected:
+    /** The way mask of each partition, set in init(). */
+    std::vector<uint64_t> wayMasks;
+
+  private:
+    /** The way masks given as parameters. */
+    const std::vector<uint64_t> initialWayMasks;
+
+  public:
+    typedef WayPartitioningPolicyParams Params;
+    WayPartitioningPolicy(const Params &p);
+
+    void init() override;
+
+    void filterByPartition(std::vector<ReplaceableEntry*> &entries,
+                           unsigned partition_id) const override;
+
+    /**
+     * Set the ways a partition may allocate into.
+     *
+     * @param partition_id The partition.
+     * @param mask The way mask of the partition.
+     */
+    void setWayMask(unsigned partition_id, uint64_t mask);
+
+    /**
+     * Get the ways a partition may allocate into.
+     *
+     * @param partition_id The partition.
+     * @return The way mask of the partition.
+     */
+    uint64_t getWayMask(unsigned partition_id) const;
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_WAY_PP_HH__
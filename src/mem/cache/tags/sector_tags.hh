@@ -175,7 +175,8 @@ class SectorTags : public BaseTags
      */
     CacheBlk* findVictim(Addr addr, const bool is_secure,
                          const std::size_t size,
-                         std::vector<CacheBlk*>& evict_blks) override;
+                         std::vector<CacheBlk*>& evict_blks,
+                         RequestorID requestor_id) override;
 
     /**
      * Calculate a block's offset in a sector from the address.
@@ -267,6 +267,16 @@ class CoherentXBar : public BaseXBar
      */
     std::unordered_set<RequestPtr> outstandingSnoop;
 
+    /**
+     * Remember where requests that expect a snoop response, and cache
+     * maintenance requests this crossbar responds to, came from so
+     * that we can route the responses to the appropriate port. This
+     * relies on the fact that the underlying Request pointer inside
+     * the Packet stays constant. Normal responses are routed using
+     * the sender state of the packet instead.
+     */
+    std::unordered_map<RequestPtr, PortID> routeTo;
+
     /**
      * Store the outstanding cache maintenance that we are expecting
      * snoop responses from so we can determine when we received all
@@ -0,0 +1,474 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Implementation of the CXLLink class, modeling the link between a
+ * host and a CXL.mem device.
+ */
+
+#include "mem/cxl_link.hh"
+
+#include "base/intmath.hh"
+#include "base/trace.hh"
+#include "debug/CXLLink.hh"
+#include "params/CXLLink.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+CXLLink::Channel::Channel(unsigned _slots_per_flit, Tick _flit_time,
+                          statistics::Scalar& _flits,
+                          statistics::Scalar& _slots)
+    : slotsPerFlit(_slots_per_flit), flitTime(_flit_time), flitStart(0),
+      slotInFlit(0), flits(_flits), slots(_slots)
+{
+}
+
+Tick
+CXLLink::Channel::transmit(unsigned num_slots, Tick when)
+{
+    // the time the next free slot of the flit being filled goes out
+    const Tick next_slot = flitStart +
+        divCeil(slotInFlit * flitTime, slotsPerFlit);
+
+    if (when > next_slot) {
+        // the channel went idle, so the flit being filled, if any,
+        // has been padded and sent, and the message starts a new one
+        flitStart = when;
+        slotInFlit = 0;
+    }
+
+    // the message is received once the flit holding its last slot is
+    const unsigned end_slot = slotInFlit + num_slots;
+    const unsigned num_flits = divCeil(end_slot, slotsPerFlit);
+    const Tick done = flitStart + num_flits * flitTime;
+
+    flits += slotInFlit == 0 ? num_flits : num_flits - 1;
+    slots += num_slots;
+
+    flitStart += (end_slot / slotsPerFlit) * flitTime;
+    slotInFlit = end_slot % slotsPerFlit;
+
+    return done;
+}
+
+CXLLink::CXLLinkResponsePort::CXLLinkResponsePort(const std::string& _name,
+    CXLLink& _link, CXLLinkRequestPort& _mem_side_port,
+    unsigned int _resp_credits, const std::vector<AddrRange>& _ranges)
+    : ResponsePort(_name), link(_link), mem_side_port(_mem_side_port),
+      ranges(_ranges.begin(), _ranges.end()),
+      outstandingResponses(0), retryReq(false),
+      respCredits(_resp_credits),
+      sendEvent([this]{ trySendTiming(); }, _name)
+{
+}
+
+CXLLink::CXLLinkRequestPort::CXLLinkRequestPort(const std::string& _name,
+    CXLLink& _link, CXLLinkResponsePort& _cpu_side_port,
+    unsigned int _req_credits)
+    : RequestPort(_name), link(_link), cpu_side_port(_cpu_side_port),
+      reqCredits(_req_credits),
+      sendEvent([this]{ trySendTiming(); }, _name)
+{
+}
+
+CXLLink::CXLLinkStats::CXLLinkStats(CXLLink &link)
+    : statistics::Group(&link),
+    ADD_STAT(reqFlits, statistics::units::Count::get(),
+             "Number of flits sent from the host to the device"),
+    ADD_STAT(reqSlots, statistics::units::Count::get(),
+             "Number of flit slots used from the host to the device"),
+    ADD_STAT(respFlits, statistics::units::Count::get(),
+             "Number of flits sent from the device to the host"),
+    ADD_STAT(respSlots, statistics::units::Count::get(),
+             "Number of flit slots used from the device to the host"),
+    ADD_STAT(reqCreditStalls, statistics::units::Count::get(),
+             "Number of requests stalled for a request credit"),
+    ADD_STAT(respCreditStalls, statistics::units::Count::get(),
+             "Number of requests stalled for a response credit"),
+    ADD_STAT(reqFlitUtil, statistics::units::Ratio::get(),
+             "Fraction of the slots used in the host to device flits"),
+    ADD_STAT(respFlitUtil, statistics::units::Ratio::get(),
+             "Fraction of the slots used in the device to host flits")
+{
+    reqFlitUtil.precision(4);
+    respFlitUtil.precision(4);
+
+    reqFlitUtil = reqSlots / (reqFlits * link.slotsPerFlit);
+    respFlitUtil = respSlots / (respFlits * link.slotsPerFlit);
+}
+
+CXLLink::CXLLink(const CXLLinkParams &p)
+    : ClockedObject(p),
+      portLatency(p.port_latency),
+      slotsPerFlit(p.slots_per_flit),
+      slotSize(p.slot_size),
+      flitTime(divCeil(p.flit_size * 8 * sim_clock::as_int::ns,
+                       p.num_lanes * p.link_speed)),
+      stats(*this),
+      reqChannel(slotsPerFlit, flitTime, stats.reqFlits, stats.reqSlots),
+      respChannel(slotsPerFlit, flitTime, stats.respFlits,
+                  stats.respSlots),
+      cpu_side_port(p.name + ".cpu_side_port", *this, mem_side_port,
+                    p.resp_credits, p.ranges),
+      mem_side_port(p.name + ".mem_side_port", *this, cpu_side_port,
+                    p.req_credits)
+{
+    fatal_if(p.num_lanes == 0 || p.link_speed == 0,
+             "%s: the link needs at least one lane with a non-zero speed",
+             name());
+    fatal_if(slotsPerFlit == 0 || slotSize == 0,
+             "%s: flits need at least one non-empty slot", name());
+    fatal_if(slotsPerFlit * slotSize > p.flit_size,
+             "%s: the slots of a flit do not fit in %d bytes", name(),
+             p.flit_size);
+    fatal_if(p.req_credits == 0 || p.resp_credits == 0,
+             "%s: the link needs at least one credit in each direction",
+             name());
+}
+
+Port&
+CXLLink::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side_port")
+        return mem_side_port;
+    else if (if_name == "cpu_side_port")
+        return cpu_side_port;
+    else
+        // pass it along to our super class
+        return ClockedObject::getPort(if_name, idx);
+}
+
+void
+CXLLink::init()
+{
+    // make sure both sides are connected
+    if (!cpu_side_port.isConnected() || !mem_side_port.isConnected())
+        fatal("Both ports of a CXL link must be connected.\n");
+
+    // notify the request side of our address ranges
+    cpu_side_port.sendRangeChange();
+}
+
+unsigned
+CXLLink::messageSlots(bool has_data, unsigned size, unsigned slot_size)
+{
+    return 1 + (has_data ? divCeil(size, slot_size) : 0);
+}
+
+unsigned
+CXLLink::messageSlots(PacketPtr pkt) const
+{
+    return messageSlots(pkt->hasData(), pkt->getSize(), slotSize);
+}
+
+Tick
+CXLLink::crossingLatency(PacketPtr pkt) const
+{
+    return 2 * portLatency +
+        divCeil(messageSlots(pkt), slotsPerFlit) * flitTime;
+}
+
+bool
+CXLLink::CXLLinkResponsePort::respCreditsUsed() const
+{
+    return outstandingResponses == respCredits;
+}
+
+bool
+CXLLink::CXLLinkRequestPort::reqCreditsUsed() const
+{
+    return transmitList.size() == reqCredits;
+}
+
+bool
+CXLLink::CXLLinkRequestPort::recvTimingResp(PacketPtr pkt)
+{
+    // a response credit was taken when the request was accepted, so
+    // we are guaranteed to have space for the response
+    DPRINTF(CXLLink, "recvTimingResp: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    // the response goes through the device port, crosses the link,
+    // and goes through the host port
+    Tick when = curTick() + pkt->headerDelay + pkt->payloadDelay +
+        link.portLatency;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    Tick t = link.respChannel.transmit(link.messageSlots(pkt), when) +
+        link.portLatency;
+    cpu_side_port.schedTimingResp(pkt, t);
+
+    return true;
+}
+
+bool
+CXLLink::CXLLinkResponsePort::recvTimingReq(PacketPtr pkt)
+{
+    DPRINTF(CXLLink, "recvTimingReq: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    // we should not see a timing request if we are already in a retry
+    assert(!retryReq);
+
+    DPRINTF(CXLLink, "Response queue size: %d outresp: %d\n",
+            transmitList.size(), outstandingResponses);
+
+    if (mem_side_port.reqCreditsUsed()) {
+        DPRINTF(CXLLink, "No request credit left\n");
+        ++link.stats.reqCreditStalls;
+        retryReq = true;
+    } else {
+        // take a response credit if we expect to see a response
+        bool expects_response = pkt->needsResponse() &&
+            !pkt->cacheResponding();
+        if (expects_response) {
+            if (respCreditsUsed()) {
+                DPRINTF(CXLLink, "No response credit left\n");
+                ++link.stats.respCreditStalls;
+                retryReq = true;
+            } else {
+                ++outstandingResponses;
+            }
+        }
+
+        if (!retryReq) {
+            // the request goes through the host port, crosses the
+            // link, and goes through the device port
+            Tick when = curTick() + pkt->headerDelay + pkt->payloadDelay +
+                link.portLatency;
+            pkt->headerDelay = pkt->payloadDelay = 0;
+
+            Tick t = link.reqChannel.transmit(link.messageSlots(pkt),
+                                              when) + link.portLatency;
+            mem_side_port.schedTimingReq(pkt, t);
+        }
+    }
+
+    // remember that we are now stalling a packet and that we have to
+    // tell the sending requestor to retry once a credit is returned
+    return !retryReq;
+}
+
+void
+CXLLink::CXLLinkResponsePort::retryStalledReq()
+{
+    if (retryReq) {
+        DPRINTF(CXLLink, "Request waiting for retry, now retrying\n");
+        retryReq = false;
+        sendRetryReq();
+    }
+}
+
+void
+CXLLink::CXLLinkRequestPort::schedTimingReq(PacketPtr pkt, Tick when)
+{
+    // the link delivers the messages in order, so the queue is
+    // ordered by time, and there is already an event scheduled for
+    // the head packet unless the queue is empty
+    assert(transmitList.empty() || transmitList.back().tick <= when);
+
+    if (transmitList.empty()) {
+        link.schedule(sendEvent, when);
+    }
+
+    assert(transmitList.size() != reqCredits);
+
+    transmitList.emplace_back(pkt, when);
+}
+
+void
+CXLLink::CXLLinkResponsePort::schedTimingResp(PacketPtr pkt, Tick when)
+{
+    assert(transmitList.empty() || transmitList.back().tick <= when);
+
+    if (transmitList.empty()) {
+        link.schedule(sendEvent, when);
+    }
+
+    transmitList.emplace_back(pkt, when);
+}
+
+void
+CXLLink::CXLLinkRequestPort::trySendTiming()
+{
+    assert(!transmitList.empty());
+
+    DeferredPacket req = transmitList.front();
+
+    assert(req.tick <= curTick());
+
+    PacketPtr pkt = req.pkt;
+
+    DPRINTF(CXLLink, "trySend request addr 0x%x, queue size %d\n",
+            pkt->getAddr(), transmitList.size());
+
+    if (sendTimingReq(pkt)) {
+        // send successful, which returns the request credit
+        transmitList.pop_front();
+
+        DPRINTF(CXLLink, "trySend request successful\n");
+
+        // if there are more packets to send, schedule event to try
+        // again
+        if (!transmitList.empty()) {
+            DeferredPacket next_req = transmitList.front();
+            DPRINTF(CXLLink, "Scheduling next send\n");
+            link.schedule(sendEvent,
+                          std::max(next_req.tick, link.clockEdge()));
+        }
+
+        // if we have stalled a request due to a lack of request
+        // credits, then send a retry at this point, also note that if
+        // the request we stalled was waiting for a response credit we
+        // might stall it again
+        cpu_side_port.retryStalledReq();
+    }
+
+    // if the send failed, then we try again once we receive a retry,
+    // and therefore there is no need to take any action
+}
+
+void
+CXLLink::CXLLinkResponsePort::trySendTiming()
+{
+    assert(!transmitList.empty());
+
+    DeferredPacket resp = transmitList.front();
+
+    assert(resp.tick <= curTick());
+
+    PacketPtr pkt = resp.pkt;
+
+    DPRINTF(CXLLink, "trySend response addr 0x%x, outstanding %d\n",
+            pkt->getAddr(), outstandingResponses);
+
+    if (sendTimingResp(pkt)) {
+        // send successful, which returns the response credit
+        transmitList.pop_front();
+        DPRINTF(CXLLink, "trySend response successful\n");
+
+        assert(outstandingResponses != 0);
+        --outstandingResponses;
+
+        // if there are more packets to send, schedule event to try
+        // again
+        if (!transmitList.empty()) {
+            DeferredPacket next_resp = transmitList.front();
+            DPRINTF(CXLLink, "Scheduling next send\n");
+            link.schedule(sendEvent,
+                          std::max(next_resp.tick, link.clockEdge()));
+        }
+
+        // if there is a request credit and we were stalling a
+        // request, it will definitely be possible to accept it now
+        // since there is a response credit
+        if (!mem_side_port.reqCreditsUsed() && retryReq) {
+            DPRINTF(CXLLink, "Request waiting for retry, now retrying\n");
+            retryReq = false;
+            sendRetryReq();
+        }
+    }
+
+    // if the send failed, then we try again once we receive a retry,
+    // and therefore there is no need to take any action
+}
+
+void
+CXLLink::CXLLinkRequestPort::recvReqRetry()
+{
+    trySendTiming();
+}
+
+void
+CXLLink::CXLLinkResponsePort::recvRespRetry()
+{
+    trySendTiming();
+}
+
+Tick
+CXLLink::CXLLinkResponsePort::recvAtomic(PacketPtr pkt)
+{
+    // pay for the request crossing the link, and for the response
+    // crossing it back
+    Tick latency = link.crossingLatency(pkt);
+    latency += mem_side_port.sendAtomic(pkt);
+    return latency + link.crossingLatency(pkt);
+}
+
+void
+CXLLink::CXLLinkResponsePort::recvFunctional(PacketPtr pkt)
+{
+    pkt->pushLabel(name());
+
+    // check the response queue
+    for (auto i = transmitList.begin();  i != transmitList.end(); ++i) {
+        if (pkt->trySatisfyFunctional((*i).pkt)) {
+            pkt->makeResponse();
+            return;
+        }
+    }
+
+    // also check the memory-side port's request queue
+    if (mem_side_port.trySatisfyFunctional(pkt)) {
+        return;
+    }
+
+    pkt->popLabel();
+
+    // fall through if pkt still not satisfied
+    mem_side_port.sendFunctional(pkt);
+}
+
+bool
+CXLLink::CXLLinkRequestPort::trySatisfyFunctional(PacketPtr pkt)
+{
+    bool found = false;
+    auto i = transmitList.begin();
+
+    while (i != transmitList.end() && !found) {
+        if (pkt->trySatisfyFunctional((*i).pkt)) {
+            pkt->makeResponse();
+            found = true;
+        }
+        ++i;
+    }
+
+    return found;
+}
+
+AddrRangeList
+CXLLink::CXLLinkResponsePort::getAddrRanges() const
+{
+    return ranges;
+}
+
+} // namespace gem5
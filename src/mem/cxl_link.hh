@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the CXLLink class, modeling the link between a host
+ * and a CXL.mem device.
+ */
+
+#ifndef __MEM_CXL_LINK_HH__
+#define __MEM_CXL_LINK_HH__
+
+#include <deque>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/port.hh"
+#include "params/CXLLink.hh"
+#include "sim/clocked_object.hh"
+
+namespace gem5
+{
+
+/**
+ * CXLLink models the CXL.mem link between a host and a Type-3 memory
+ * device, in the same spirit as the SerialLink. Messages are packed
+ * into the slots of fixed-size flits, and a message is only handed to
+ * the far side once the flit holding its last slot has arrived, as
+ * the receiver checks the flit CRC first. Every crossing also pays the
+ * latency of the ports at both ends of the link.
+ *
+ * Flow control follows the link layer credits: a request is only put
+ * on the link if the device side has a buffer credit left for it,
+ * and, if it expects a response, if the host side has a credit for
+ * the response. Credits are returned as the buffered messages leave
+ * the link.
+ */
+class CXLLink : public ClockedObject
+{
+  public:
+
+    /**
+     * One direction of the link. Messages are packed back to back into
+     * the slots of the flits. If the channel goes idle, the flit being
+     * filled is padded and sent, and the next message starts a new
+     * flit.
+     */
+    class Channel
+    {
+      public:
+
+        /**
+         * Create a channel.
+         *
+         * @param _slots_per_flit number of slots in a flit
+         * @param _flit_time time to transmit one flit
+         * @param _flits stat counting the flits sent
+         * @param _slots stat counting the slots used
+         */
+        Channel(unsigned _slots_per_flit, Tick _flit_time,
+                statistics::Scalar& _flits, statistics::Scalar& _slots);
+
+        /**
+         * Transmit a message over the channel.
+         *
+         * @param num_slots number of slots used by the message
+         * @param when tick the message is ready to be transmitted
+         * @return tick the receiver has the complete message
+         */
+        Tick transmit(unsigned num_slots, Tick when);
+
+      private:
+
+        /** Number of slots in a flit. */
+        const unsigned slotsPerFlit;
+
+        /** Time to transmit one flit over all the lanes. */
+        const Tick flitTime;
+
+        /** Start of the flit currently being filled. */
+        Tick flitStart;
+
+        /** Number of slots used in the flit being filled. */
+        unsigned slotInFlit;
+
+        statistics::Scalar& flits;
+        statistics::Scalar& slots;
+    };
+
+    /**
+     * Number of slots a message takes on the link: a header slot, and
+     * the data slots if the message carries data.
+     *
+     * @param has_data if the message carries data
+     * @param size size of the data in bytes
+     * @param slot_size number of bytes of data in a slot
+     * @return number of slots used by the message
+     */
+    static unsigned messageSlots(bool has_data, unsigned size,
+                                 unsigned slot_size);
+
+  protected:
+
+    /**
+     * A deferred packet stores a packet along with the time it is
+     * available on the receiving side of the link.
+     */
+    class DeferredPacket
+    {
+
+      public:
+
+        const Tick tick;
+        const PacketPtr pkt;
+
+        DeferredPacket(PacketPtr _pkt, Tick _tick) : tick(_tick), pkt(_pkt)
+        { }
+    };
+
+    // Forward declaration to allow the CPU-side port to have a pointer
+    class CXLLinkRequestPort;
+
+    /**
+     * The port on the host side of the link, receiving requests and
+     * sending responses. It buffers the responses that have crossed
+     * the link, and holds the response credits.
+     */
+    class CXLLinkResponsePort : public ResponsePort
+    {
+
+      private:
+
+        /** The link to which this port belongs. */
+        CXLLink& link;
+
+        /** Request port on the other side of the link. */
+        CXLLinkRequestPort& mem_side_port;
+
+        /** Address ranges to pass through the link. */
+        const AddrRangeList ranges;
+
+        /**
+         * Responses that are crossing, or have crossed, the link. We
+         * use a deque as we need to iterate over the items for
+         * functional accesses.
+         */
+        std::deque<DeferredPacket> transmitList;
+
+        /** Number of response credits in use. */
+        unsigned int outstandingResponses;
+
+        /** If we should send a retry when a credit is returned. */
+        bool retryReq;
+
+        /** Number of response credits. */
+        const unsigned int respCredits;
+
+        /**
+         * Are all the response credits in use.
+         *
+         * @return true if no response credit is left
+         */
+        bool respCreditsUsed() const;
+
+        /**
+         * Handle send event, scheduled when the packet at the head of
+         * the response queue is ready to transmit.
+         */
+        void trySendTiming();
+
+        /** Send event for the response queue. */
+        EventFunctionWrapper sendEvent;
+
+      public:
+
+        /**
+         * Constructor for the CXLLinkResponsePort.
+         *
+         * @param _name the port name including the owner
+         * @param _link the structural owner
+         * @param _mem_side_port the memory-side port on the other
+         * side of the link
+         * @param _resp_credits the number of response credits
+         * @param _ranges a number of address ranges to forward
+         */
+        CXLLinkResponsePort(const std::string& _name, CXLLink& _link,
+                            CXLLinkRequestPort& _mem_side_port,
+                            unsigned int _resp_credits,
+                            const std::vector<AddrRange>& _ranges);
+
+        /**
+         * Queue a response packet to be sent out later and also
+         * schedule a send if necessary.
+         *
+         * @param pkt a response to send out after a delay
+         * @param when tick when response packet should be sent
+         */
+        void schedTimingResp(PacketPtr pkt, Tick when);
+
+        /**
+         * Retry any stalled request that we have failed to accept at
+         * an earlier point in time. This call will do nothing if no
+         * request is waiting.
+         */
+        void retryStalledReq();
+
+      protected:
+
+        bool recvTimingReq(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    /**
+     * The port on the device side of the link, sending requests and
+     * receiving responses. It buffers the requests that have crossed
+     * the link, one per request credit.
+     */
+    class CXLLinkRequestPort : public RequestPort
+    {
+
+      private:
+
+        /** The link to which this port belongs. */
+        CXLLink& link;
+
+        /** The response port on the other side of the link. */
+        CXLLinkResponsePort& cpu_side_port;
+
+        /**
+         * Requests that are crossing, or have crossed, the link. We
+         * use a deque as we need to iterate over the items for
+         * functional accesses.
+         */
+        std::deque<DeferredPacket> transmitList;
+
+        /** Number of request credits. */
+        const unsigned int reqCredits;
+
+        /**
+         * Handle send event, scheduled when the packet at the head of
+         * the request queue is ready to transmit.
+         */
+        void trySendTiming();
+
+        /** Send event for the request queue. */
+        EventFunctionWrapper sendEvent;
+
+      public:
+
+        /**
+         * Constructor for the CXLLinkRequestPort.
+         *
+         * @param _name the port name including the owner
+         * @param _link the structural owner
+         * @param _cpu_side_port the CPU-side port on the other side
+         * of the link
+         * @param _req_credits the number of request credits
+         */
+        CXLLinkRequestPort(const std::string& _name, CXLLink& _link,
+                           CXLLinkResponsePort& _cpu_side_port,
+                           unsigned int _req_credits);
+
+        /**
+         * Are all the request credits in use.
+         *
+         * @return true if no request credit is left
+         */
+        bool reqCreditsUsed() const;
+
+        /**
+         * Queue a request packet to be sent out later and also
+         * schedule a send if necessary.
+         *
+         * @param pkt a request to send out after a delay
+         * @param when tick when request packet should be sent
+         */
+        void schedTimingReq(PacketPtr pkt, Tick when);
+
+        /**
+         * Check a functional request against the packets in our
+         * request queue.
+         *
+         * @param pkt packet to check against
+         *
+         * @return true if we find a match
+         */
+        bool trySatisfyFunctional(PacketPtr pkt);
+
+      protected:
+
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvReqRetry() override;
+    };
+
+    /** Number of slots the message of a packet takes on the link. */
+    unsigned messageSlots(PacketPtr pkt) const;
+
+    /**
+     * Latency of a message crossing the link on its own, used for
+     * atomic accesses.
+     */
+    Tick crossingLatency(PacketPtr pkt) const;
+
+    /** Latency of a port at either end of the link. */
+    const Tick portLatency;
+
+    /** Number of slots in a flit. */
+    const unsigned slotsPerFlit;
+
+    /** Number of bytes of data in a slot. */
+    const unsigned slotSize;
+
+    /** Time to transmit one flit over all the lanes. */
+    const Tick flitTime;
+
+    struct CXLLinkStats : public statistics::Group
+    {
+        CXLLinkStats(CXLLink &link);
+
+        statistics::Scalar reqFlits;
+        statistics::Scalar reqSlots;
+        statistics::Scalar respFlits;
+        statistics::Scalar respSlots;
+        statistics::Scalar reqCreditStalls;
+        statistics::Scalar respCreditStalls;
+        statistics::Formula reqFlitUtil;
+        statistics::Formula respFlitUtil;
+    } stats;
+
+    /** Host to device channel. */
+    Channel reqChannel;
+
+    /** Device to host channel. */
+    Channel respChannel;
+
+    /** Response port of the link. */
+    CXLLinkResponsePort cpu_side_port;
+
+    /** Request port of the link. */
+    CXLLinkRequestPort mem_side_port;
+
+  public:
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+
+    typedef CXLLinkParams Params;
+
+    CXLLink(const CXLLinkParams &p);
+};
+
+} // namespace gem5
+
+#endif //__MEM_CXL_LINK_HH__
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "base/statistics.hh"
+#include "base/stats/group.hh"
+#include "base/types.hh"
+#include "mem/cxl_link.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Flits of four 16B slots, taking 1000 ticks each to transmit. */
+const unsigned slotsPerFlit = 4;
+const unsigned slotSize = 16;
+const Tick flitTime = 1000;
+
+/** A channel, along with the stats it counts the flits and slots in. */
+class CXLChannelTest : public testing::Test
+{
+  protected:
+    statistics::Group group;
+    statistics::Scalar flits;
+    statistics::Scalar slots;
+    CXLLink::Channel channel;
+
+    CXLChannelTest()
+      : group(nullptr), flits(&group, "flits"), slots(&group, "slots"),
+        channel(slotsPerFlit, flitTime, flits, slots)
+    {}
+};
+
+} // anonymous namespace
+
+/** A header slot, plus the data slots for messages carrying data. */
+TEST(CXLLinkTest, MessageSlots)
+{
+    EXPECT_EQ(1, CXLLink::messageSlots(false, 64, slotSize));
+    EXPECT_EQ(5, CXLLink::messageSlots(true, 64, slotSize));
+    EXPECT_EQ(2, CXLLink::messageSlots(true, 8, slotSize));
+    EXPECT_EQ(3, CXLLink::messageSlots(true, 17, slotSize));
+}
+
+/**
+ * Messages ready while a flit is being filled share it, and only the
+ * first message of a new flit starts one.
+ */
+TEST_F(CXLChannelTest, BackToBackMessagesShareFlits)
+{
+
+    for (int i = 0; i < slotsPerFlit; ++i) {
+        EXPECT_EQ(flitTime, channel.transmit(1, 0));
+        EXPECT_EQ(1, flits.value());
+    }
+    EXPECT_EQ(slotsPerFlit, slots.value());
+
+    // the first flit is full, so the next message goes in the second
+    EXPECT_EQ(2 * flitTime, channel.transmit(1, 0));
+    EXPECT_EQ(2, flits.value());
+    EXPECT_EQ(slotsPerFlit + 1, slots.value());
+}
+
+/**
+ * A message ready before the next free slot of the flit goes out joins
+ * the flit, but once the channel has gone idle the flit is padded and
+ * the message starts a new flit.
+ */
+TEST_F(CXLChannelTest, IdleChannelPadsFlit)
+{
+
+    EXPECT_EQ(flitTime, channel.transmit(1, 0));
+
+    // the second slot goes out at a quarter of the flit time
+    EXPECT_EQ(flitTime, channel.transmit(1, flitTime / 4));
+    EXPECT_EQ(1, flits.value());
+
+    // the third slot went out at half the flit time, so it is padded
+    const Tick when = flitTime / 2 + 1;
+    EXPECT_EQ(when + flitTime, channel.transmit(1, when));
+    EXPECT_EQ(2, flits.value());
+
+    // long after the channel went idle
+    EXPECT_EQ(10 * flitTime, channel.transmit(1, 9 * flitTime));
+    EXPECT_EQ(3, flits.value());
+    EXPECT_EQ(4, slots.value());
+}
+
+/**
+ * A 64B data response takes five slots, so it spills over into a
+ * second flit, and the following response continues in that flit.
+ */
+TEST_F(CXLChannelTest, DataResponseSpansFlits)
+{
+    const unsigned num_slots = CXLLink::messageSlots(true, 64, slotSize);
+
+    EXPECT_EQ(2 * flitTime, channel.transmit(num_slots, 0));
+    EXPECT_EQ(2, flits.value());
+    EXPECT_EQ(5, slots.value());
+
+    // the second response fills the last three slots of the second
+    // flit, and two slots of the third
+    EXPECT_EQ(3 * flitTime, channel.transmit(num_slots, 0));
+    EXPECT_EQ(3, flits.value());
+    EXPECT_EQ(10, slots.value());
+
+    // a read request still fits in the third flit
+    EXPECT_EQ(3 * flitTime, channel.transmit(1, 0));
+    EXPECT_EQ(3, flits.value());
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2010-2020 ARM Limited
+ * All rights reserved
+ *
+ * The license below extends only to copyright in the software and shall
+ * not be construed as granting a license to any other intellectual
+ * property including but not limited to intellectual property relating
+ * to a hardware implementation of the functionality of the software
+ * licensed hereunder.  You may use the software subject to the license
+ * terms below provided that you ensure that this notice is replicated
+ * unmodified and in its entirety in all distributions of the software,
+ * modified or unmodified, in source code or in binary form.
+ *
+ * Copyright (c) 2013 Amin Farmahini-Farahani
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/dram_addr_map.hh"
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+void
+DRAMAddrMap::decode(Addr ctrl_addr, Addr addr, uint8_t &rank, uint8_t &bank,
+                    uint64_t &row) const
+{
+    // decode the address based on the address mapping scheme, with
+    // Ro, Ra, Co, Ba and Ch denoting row, rank, column, bank and
+    // channel, respectively
+
+    // truncate the address to a memory burst, which makes it unique to
+    // a specific buffer, row, bank, rank and channel
+    Addr burst = ctrl_addr / burstSize;
+
+    // we have removed the lowest order address bits that denote the
+    // position within the column
+    if (mapping == enums::RoRaBaChCo || mapping == enums::RoRaBaCoCh) {
+        // the lowest order bits denote the column to ensure that
+        // sequential cache lines occupy the same row
+        burst = burst / burstsPerRowBuffer;
+
+        // after the channel bits, get the bank bits to interleave
+        // over the banks
+        bank = burst % banksPerRank;
+        burst = burst / banksPerRank;
+
+        // after the bank, we get the rank bits which thus interleaves
+        // over the ranks
+        rank = burst % ranksPerChannel;
+        burst = burst / ranksPerChannel;
+
+        // lastly, get the row bits, no need to remove them from addr
+        row = burst % rowsPerBank;
+    } else if (mapping == enums::RoCoRaBaCh) {
+        // with emerging technologies, could have small page size with
+        // interleaving granularity greater than row buffer
+        if (burstsPerStripe > burstsPerRowBuffer) {
+            // remove column bits which are a subset of burstsPerStripe
+            burst = burst / burstsPerRowBuffer;
+        } else {
+            // remove lower column bits below channel bits
+            burst = burst / burstsPerStripe;
+        }
+
+        // start with the bank bits, as this provides the maximum
+        // opportunity for parallelism between requests
+        bank = burst % banksPerRank;
+        burst = burst / banksPerRank;
+
+        // next get the rank bits
+        rank = burst % ranksPerChannel;
+        burst = burst / ranksPerChannel;
+
+        // next, the higher-order column bites
+        if (burstsPerStripe < burstsPerRowBuffer) {
+            burst = burst / (burstsPerRowBuffer / burstsPerStripe);
+        }
+
+        // lastly, get the row bits, no need to remove them from addr
+        row = burst % rowsPerBank;
+    } else {
+        panic("Unknown address mapping policy chosen!");
+    }
+
+    // apply the programmable address mapping, if any, on top of the
+    // fixed one
+    if (!rankMasks.empty())
+        rank = hashAddr(addr, rankMasks);
+    if (!bankGroupMasks.empty() || !bankMasks.empty()) {
+        uint64_t bank_group = bank % bankGroups;
+        uint64_t group_bank = bank / bankGroups;
+        if (!bankGroupMasks.empty())
+            bank_group = hashAddr(addr, bankGroupMasks);
+        if (!bankMasks.empty())
+            group_bank = hashAddr(addr, bankMasks);
+        bank = group_bank * bankGroups + bank_group;
+    }
+    if (!rowMasks.empty())
+        row = hashAddr(addr, rowMasks);
+}
+
+} // namespace memory
+} // namespace gem5
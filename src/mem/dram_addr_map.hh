@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2010-2020 ARM Limited
+ * All rights reserved
+ *
+ * The license below extends only to copyright in the software and shall
+ * not be construed as granting a license to any other intellectual
+ * property including but not limited to intellectual property relating
+ * to a hardware implementation of the functionality of the software
+ * licensed hereunder.  You may use the software subject to the license
+ * terms below provided that you ensure that this notice is replicated
+ * unmodified and in its entirety in all distributions of the software,
+ * modified or unmodified, in source code or in binary form.
+ *
+ * Copyright (c) 2013 Amin Farmahini-Farahani
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_DRAM_ADDR_MAP_HH__
+#define __MEM_DRAM_ADDR_MAP_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/types.hh"
+#include "enums/AddrMap.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * The address mapping of a DRAM interface, decoding the address of a
+ * burst into the rank, bank and row it maps to. The fixed mapping can
+ * be overridden field by field by a programmable XOR mapping: when the
+ * masks of a field are not empty, bit i of the field is the parity of
+ * the physical address bits selected by mask i.
+ */
+struct DRAMAddrMap
+{
+    enums::AddrMap mapping;
+    uint32_t burstSize;
+    uint32_t burstsPerRowBuffer;
+    uint32_t burstsPerStripe;
+    uint32_t ranksPerChannel;
+    uint32_t banksPerRank;
+    /** Bank groups per rank, 1 without bank group architecture */
+    uint32_t bankGroups;
+    uint32_t rowsPerBank;
+
+    std::vector<Addr> rankMasks;
+    std::vector<Addr> bankGroupMasks;
+    std::vector<Addr> bankMasks;
+    std::vector<Addr> rowMasks;
+
+    /**
+     * Compute a field of the programmable address mapping.
+     *
+     * @param addr The physical address
+     * @param masks One mask per bit of the field, LSB first
+     * @return The value of the field
+     */
+    static uint64_t
+    hashAddr(Addr addr, const std::vector<Addr> &masks)
+    {
+        uint64_t field = 0;
+        for (size_t i = 0; i < masks.size(); i++) {
+            field |= uint64_t(popCount(addr & masks[i]) % 2) << i;
+        }
+        return field;
+    }
+
+    /**
+     * Decode an address. The bank is split in the bank group, its
+     * low-order bits, and the bank within the group.
+     *
+     * @param ctrl_addr The address within the channel, starting at 0
+     * @param addr The physical address, used by the XOR mapping
+     * @param rank The rank the address maps to
+     * @param bank The bank within the rank
+     * @param row The row within the bank
+     */
+    void decode(Addr ctrl_addr, Addr addr, uint8_t &rank, uint8_t &bank,
+                uint64_t &row) const;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_DRAM_ADDR_MAP_HH__
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <tuple>
+
+#include "mem/dram_addr_map.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+/**
+ * A small channel of 2 ranks of 8 banks in 4 bank groups, with 64
+ * rows of 16 bursts of 64 bytes. With RoRaBaChCo, the burst offset is
+ * in address bits 0-5, the column in bits 6-9, the bank in bits 10-12
+ * (the bank group in bits 10-11), the rank in bit 13 and the row in
+ * bits 14-19.
+ */
+DRAMAddrMap
+makeAddrMap(enums::AddrMap mapping)
+{
+    DRAMAddrMap map;
+    map.mapping = mapping;
+    map.burstSize = 64;
+    map.burstsPerRowBuffer = 16;
+    map.burstsPerStripe = 1;
+    map.ranksPerChannel = 2;
+    map.banksPerRank = 8;
+    map.bankGroups = 4;
+    map.rowsPerBank = 64;
+    return map;
+}
+
+const Addr channelSize = 64 * 16 * 8 * 2 * 64;
+
+} // anonymous namespace
+
+/** Bit i of a field is the parity of the bits selected by mask i. */
+TEST(DRAMAddrMapTest, HashAddr)
+{
+    EXPECT_EQ(0, DRAMAddrMap::hashAddr(0xb, {}));
+    EXPECT_EQ(0x2, DRAMAddrMap::hashAddr(0xb, {0x3, 0x8, 0x4}));
+    EXPECT_EQ(0x1, DRAMAddrMap::hashAddr(0xb, {0xb}));
+    EXPECT_EQ(0x3, DRAMAddrMap::hashAddr(0x10, {0x11, 0x30}));
+}
+
+/** Without masks, the fixed mappings are used unchanged. */
+TEST(DRAMAddrMapTest, EmptyMasksMatchFixedMapping)
+{
+    const DRAMAddrMap ro_ra_ba_ch_co = makeAddrMap(enums::RoRaBaChCo);
+    const DRAMAddrMap ro_co_ra_ba_ch = makeAddrMap(enums::RoCoRaBaCh);
+
+    for (Addr addr = 0; addr < channelSize; addr += 64) {
+        const Addr burst = addr / 64;
+        uint8_t rank, bank;
+        uint64_t row;
+
+        ro_ra_ba_ch_co.decode(addr, addr, rank, bank, row);
+        EXPECT_EQ((burst / 16) % 8, bank);
+        EXPECT_EQ((burst / (16 * 8)) % 2, rank);
+        EXPECT_EQ(burst / (16 * 8 * 2), row);
+
+        ro_co_ra_ba_ch.decode(addr, addr, rank, bank, row);
+        EXPECT_EQ(burst % 8, bank);
+        EXPECT_EQ((burst / 8) % 2, rank);
+        EXPECT_EQ(burst / (8 * 2 * 16), row);
+    }
+}
+
+/**
+ * Masks that XOR the bank and rank bits with row bits, and permute the
+ * row bits, map every burst of the channel to a distinct location.
+ */
+TEST(DRAMAddrMapTest, HashedMappingIsBijective)
+{
+    DRAMAddrMap map = makeAddrMap(enums::RoRaBaChCo);
+    map.bankGroupMasks = {(1ULL << 10) | (1ULL << 14),
+                          (1ULL << 11) | (1ULL << 15)};
+    map.bankMasks = {(1ULL << 12) | (1ULL << 16) | (1ULL << 7)};
+    map.rankMasks = {(1ULL << 13) | (1ULL << 17) | (1ULL << 18)};
+    map.rowMasks = {(1ULL << 14) | (1ULL << 19), 1ULL << 15,
+                    (1ULL << 16) | (1ULL << 14), 1ULL << 17,
+                    1ULL << 18, 1ULL << 19};
+
+    std::set<std::tuple<uint8_t, uint8_t, uint64_t, Addr>> locations;
+    for (Addr addr = 0; addr < channelSize; addr += 64) {
+        uint8_t rank, bank;
+        uint64_t row;
+        map.decode(addr, addr, rank, bank, row);
+        ASSERT_LT(rank, map.ranksPerChannel);
+        ASSERT_LT(bank, map.banksPerRank);
+        ASSERT_LT(row, map.rowsPerBank);
+
+        // the column is not hashed
+        const Addr column = (addr / 64) % 16;
+        EXPECT_TRUE(locations.emplace(rank, bank, row, column).second)
+            << "address " << addr << " aliases with another one";
+    }
+    EXPECT_EQ(channelSize / 64, locations.size());
+}
@@ -0,0 +1,809 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/dram_cache_ctrl.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/cast.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/DRAMCache.hh"
+#include "debug/Drain.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+DRAMCacheCtrl::DRAMCacheCtrl(const Params &p)
+    : ClockedObject(p),
+      nextReqEvent([this]{ processNextReqEvent(); }, name()),
+      cpuSidePort(name() + ".cpu_side_port", *this),
+      cacheSidePort(name() + ".cache_side_port", *this),
+      memSidePort(name() + ".mem_side_port", *this),
+      requestorId(p.system->getRequestorId(this)),
+      blkSize(p.block_size),
+      assoc(p.assoc),
+      numSets(p.size / (p.block_size * p.assoc)),
+      cacheBase(p.cache_base),
+      tagLatency(p.tag_latency),
+      responseLatency(p.response_latency),
+      requestBufferSize(p.request_buffer_size),
+      writeBufferSize(p.write_buffer_size),
+      tags(numSets * assoc),
+      recency(numSets * assoc),
+      predictor(p.predictor_entries, SatCounter8(p.predictor_bits)),
+      setBusy(numSets, false),
+      stats(*this)
+{
+    fatal_if(!isPowerOf2(blkSize), "Block size must be a power of 2");
+    fatal_if(assoc == 0 || assoc > 256,
+             "Associativity must be between 1 and 256");
+    fatal_if(numSets == 0 || p.size % (blkSize * assoc) != 0,
+             "Cache size must be a multiple of the size of a set");
+    fatal_if(p.predictor_bits == 0 || p.predictor_bits > 8,
+             "Predictor counters must have between 1 and 8 bits");
+    fatal_if(requestBufferSize == 0, "Request buffer must not be empty");
+
+    for (unsigned set = 0; set < numSets; set++) {
+        for (unsigned way = 0; way < assoc; way++) {
+            recency[set * assoc + way] = way;
+        }
+    }
+}
+
+DRAMCacheCtrl::~DRAMCacheCtrl()
+{
+    for (auto *txn : transactions)
+        delete txn;
+    for (auto pkt : writeBuffer)
+        delete pkt;
+}
+
+void
+DRAMCacheCtrl::init()
+{
+    fatal_if(!cpuSidePort.isConnected() || !cacheSidePort.isConnected() ||
+             !memSidePort.isConnected(),
+             "DRAM cache controller %s is not fully connected", name());
+
+    cpuSidePort.sendRangeChange();
+}
+
+Port &
+DRAMCacheCtrl::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "cpu_side_port") {
+        return cpuSidePort;
+    } else if (if_name == "cache_side_port") {
+        return cacheSidePort;
+    } else if (if_name == "mem_side_port") {
+        return memSidePort;
+    } else {
+        return ClockedObject::getPort(if_name, idx);
+    }
+}
+
+bool
+DRAMCacheCtrl::recvTimingReq(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+    panic_if(!(pkt->isRead() || pkt->isWrite()),
+             "Should only see read and writes at DRAM cache controller\n");
+    panic_if(roundDown(pkt->getAddr() + pkt->getSize() - 1, blkSize) !=
+             pkt->getBlockAddr(blkSize),
+             "%s spans more than one DRAM cache line", pkt->print());
+
+    if (requestBuffer.size() >= requestBufferSize) {
+        DPRINTF(DRAMCache, "Request buffer full, retrying %s\n",
+                pkt->print());
+        retryReq = true;
+        return false;
+    }
+
+    DPRINTF(DRAMCache, "Buffering %s\n", pkt->print());
+    requestBuffer.push_back(pkt);
+
+    if (!nextReqEvent.scheduled())
+        schedule(nextReqEvent, clockEdge());
+
+    return true;
+}
+
+void
+DRAMCacheCtrl::processNextReqEvent()
+{
+    // the requests to a busy set wait for it, so the first request of
+    // the buffer whose set is free is also the oldest request to its set
+    for (auto it = requestBuffer.begin(); it != requestBuffer.end(); ++it) {
+        PacketPtr pkt = *it;
+        if (setBusy[setIndex(pkt->getBlockAddr(blkSize))])
+            continue;
+
+        requestBuffer.erase(it);
+        startTransaction(pkt);
+
+        // start at most one transaction per cycle
+        if (!requestBuffer.empty())
+            schedule(nextReqEvent, clockEdge(Cycles(1)));
+
+        if (retryReq) {
+            retryReq = false;
+            cpuSidePort.sendRetryReq();
+        }
+        return;
+    }
+
+    // all the buffered requests wait for a set, which will reschedule
+    // this event once it is released
+}
+
+void
+DRAMCacheCtrl::startTransaction(PacketPtr pkt)
+{
+    auto *txn = new Transaction;
+    transactions.insert(txn);
+
+    txn->pkt = pkt;
+    txn->entryTime = curTick();
+    txn->blkAddr = pkt->getBlockAddr(blkSize);
+    txn->set = setIndex(txn->blkAddr);
+    setBusy[txn->set] = true;
+
+    // the set is busy until the transaction is done, so the outcome of
+    // the tag check can already be decided
+    txn->way = findWay(txn->set, txn->blkAddr);
+    txn->hit = txn->way < assoc;
+    if (!txn->hit) {
+        txn->way = findVictim(txn->set);
+
+        // a dirty line that has not yet been written back must not be
+        // read from the backing memory
+        if (PacketPtr wb_pkt = findWriteBack(txn->blkAddr)) {
+            const uint8_t *wb_data = wb_pkt->getConstPtr<uint8_t>();
+            txn->data.assign(wb_data, wb_data + blkSize);
+            txn->memDataReady = true;
+            stats.writeBufferHits++;
+        }
+    }
+
+    DPRINTF(DRAMCache, "Starting %s in set %d, %s way %d\n", pkt->print(),
+            txn->set, txn->hit ? "hit in" : "victim", txn->way);
+
+    // reads predicted to miss access the backing memory right away
+    if (pkt->isRead() && !predictor.empty()) {
+        const SatCounter8 &counter = predictor[predictorIndex(pkt)];
+        txn->predictedMiss = counter.calcSaturation() >= 0.5;
+        if (txn->predictedMiss) {
+            stats.predictedMisses++;
+            if (!txn->memDataReady) {
+                sendAccess(txn, Access::MemRead, txn->blkAddr, blkSize,
+                           nullptr, clockEdge());
+                txn->memReadIssued = true;
+            }
+        }
+    }
+
+    // every access starts with a read of the tags of the set, along
+    // with the data of its first way
+    sendAccess(txn, Access::TagRead, frameAddr(txn->set, 0), blkSize,
+               nullptr, clockEdge());
+}
+
+void
+DRAMCacheCtrl::tagChecked(Transaction *txn, PacketPtr tag_pkt)
+{
+    PacketPtr pkt = txn->pkt;
+    const Tick when = clockEdge(tagLatency);
+    txn->tagDone = true;
+
+    if (pkt->isRead() && !predictor.empty()) {
+        SatCounter8 &counter = predictor[predictorIndex(pkt)];
+        if (txn->hit) {
+            counter--;
+            if (txn->memReadIssued)
+                stats.wastedMemReads++;
+        } else {
+            counter++;
+            if (!txn->predictedMiss)
+                stats.serializedMisses++;
+        }
+    }
+
+    if (txn->hit) {
+        touch(txn->set, txn->way);
+
+        if (pkt->isWrite()) {
+            stats.writeHits++;
+            if (pkt->cmd != MemCmd::WritebackClean)
+                tagEntry(txn->set, txn->way).dirty = true;
+            // the set is released once the write is done, so that the
+            // later accesses to it see the new data
+            sendAccess(txn, Access::CacheWrite,
+                       frameAddr(txn->set, txn->way) + pkt->getOffset(blkSize),
+                       pkt->getSize(), pkt->getConstPtr<uint8_t>(), when);
+            respond(txn, nullptr, tagLatency);
+        } else {
+            stats.readHits++;
+            if (txn->way == 0) {
+                respond(txn, tag_pkt->getConstPtr<uint8_t>(), tagLatency);
+                finishTransaction(txn);
+            } else {
+                sendAccess(txn, Access::DataRead,
+                           frameAddr(txn->set, txn->way), blkSize, nullptr,
+                           when);
+            }
+        }
+        return;
+    }
+
+    if (pkt->isWrite())
+        stats.writeMisses++;
+    else
+        stats.readMisses++;
+
+    TagEntry &victim = tagEntry(txn->set, txn->way);
+    if (victim.valid && victim.dirty) {
+        DPRINTF(DRAMCache, "Evicting dirty line %#x from set %d way %d\n",
+                victim.blkAddr, txn->set, txn->way);
+        if (txn->way == 0) {
+            addWriteBack(victim.blkAddr, tag_pkt->getConstPtr<uint8_t>());
+        } else {
+            txn->victimAddr = victim.blkAddr;
+            txn->victimPending = true;
+            sendAccess(txn, Access::VictimRead,
+                       frameAddr(txn->set, txn->way), blkSize, nullptr,
+                       when);
+        }
+    }
+    // a victim still being read stays valid until it is written back,
+    // so that the functional accesses find its data in the cache memory
+    if (!txn->victimPending)
+        victim.valid = false;
+
+    if (pkt->isWrite() && pkt->getSize() == blkSize &&
+        !pkt->isMaskedWrite()) {
+        // the write provides the whole line
+        txn->data.resize(blkSize);
+        txn->memDataReady = true;
+    } else if (!txn->memDataReady && !txn->memReadIssued) {
+        sendAccess(txn, Access::MemRead, txn->blkAddr, blkSize, nullptr,
+                   when);
+        txn->memReadIssued = true;
+    }
+
+    tryFill(txn);
+}
+
+void
+DRAMCacheCtrl::tryFill(Transaction *txn)
+{
+    if (!txn->tagDone || !txn->memDataReady || txn->victimPending)
+        return;
+
+    PacketPtr pkt = txn->pkt;
+    if (pkt->isWrite())
+        pkt->writeDataToBlock(txn->data.data(), blkSize);
+
+    DPRINTF(DRAMCache, "Filling line %#x in set %d way %d\n", txn->blkAddr,
+            txn->set, txn->way);
+
+    TagEntry &entry = tagEntry(txn->set, txn->way);
+    entry.blkAddr = txn->blkAddr;
+    entry.valid = true;
+    entry.dirty = pkt->isWrite() && pkt->cmd != MemCmd::WritebackClean;
+    touch(txn->set, txn->way);
+
+    // the set is released once the fill is done
+    sendAccess(txn, Access::CacheWrite, frameAddr(txn->set, txn->way),
+               blkSize, txn->data.data(), clockEdge());
+
+    stats.missLatency += clockEdge(responseLatency) - txn->entryTime;
+    respond(txn, txn->data.data());
+}
+
+void
+DRAMCacheCtrl::finishTransaction(Transaction *txn)
+{
+    // the accesses of this transaction that change the cache memory are
+    // done, so the set can be used again
+    txn->done = true;
+    setBusy[txn->set] = false;
+
+    if (!requestBuffer.empty() && !nextReqEvent.scheduled())
+        schedule(nextReqEvent, clockEdge());
+}
+
+void
+DRAMCacheCtrl::respond(Transaction *txn, const uint8_t *blk_data,
+                       Cycles delay)
+{
+    PacketPtr pkt = txn->pkt;
+    txn->pkt = nullptr;
+
+    if (pkt->isRead())
+        pkt->setDataFromBlock(blk_data, blkSize);
+
+    if (!pkt->needsResponse()) {
+        delete pkt;
+        return;
+    }
+
+    // the request only reached us after its header and payload delay
+    const Tick when = clockEdge(delay + responseLatency) +
+        pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    pkt->makeResponse();
+    cpuSidePort.schedTimingResp(pkt, when);
+}
+
+void
+DRAMCacheCtrl::sendAccess(Transaction *txn, Access access, Addr addr,
+                          unsigned size, const uint8_t *data, Tick when)
+{
+    const bool is_write = access == Access::CacheWrite;
+    RequestPtr req = std::make_shared<Request>(addr, size, 0, requestorId);
+    PacketPtr pkt = new Packet(req, is_write ? MemCmd::WriteReq :
+                                               MemCmd::ReadReq);
+    pkt->allocate();
+    if (is_write)
+        pkt->setData(data);
+    pkt->pushSenderState(new SenderState(txn, access));
+    txn->outstanding++;
+
+    if (access == Access::MemRead) {
+        pendingMemReads++;
+        memSidePort.schedTimingReq(pkt, when);
+    } else {
+        cacheSidePort.schedTimingReq(pkt, when);
+    }
+}
+
+bool
+DRAMCacheCtrl::recvTimingResp(PacketPtr pkt)
+{
+    auto *state = safe_cast<SenderState *>(pkt->popSenderState());
+    Transaction *txn = state->txn;
+    const Access access = state->access;
+    delete state;
+
+    DPRINTF(DRAMCache, "Received %s\n", pkt->print());
+
+    switch (access) {
+      case Access::TagRead:
+        tagChecked(txn, pkt);
+        break;
+      case Access::DataRead:
+        respond(txn, pkt->getConstPtr<uint8_t>());
+        finishTransaction(txn);
+        break;
+      case Access::VictimRead:
+        addWriteBack(txn->victimAddr, pkt->getConstPtr<uint8_t>());
+        tagEntry(txn->set, txn->way).valid = false;
+        txn->victimPending = false;
+        tryFill(txn);
+        break;
+      case Access::CacheWrite:
+        // a transaction ends with its only write to the cache memory
+        finishTransaction(txn);
+        break;
+      case Access::MemRead:
+        pendingMemReads--;
+        // the line of a hit is read from the cache
+        if (!txn->hit) {
+            const uint8_t *mem_data = pkt->getConstPtr<uint8_t>();
+            txn->data.assign(mem_data, mem_data + blkSize);
+            txn->memDataReady = true;
+            tryFill(txn);
+        }
+        drainWriteBuffer();
+        break;
+      case Access::WriteBack:
+        pendingWriteBacks--;
+        break;
+    }
+
+    delete pkt;
+
+    if (txn && --txn->outstanding == 0 && txn->done) {
+        transactions.erase(txn);
+        delete txn;
+    }
+
+    if (drainState() == DrainState::Draining && isDrained()) {
+        DPRINTF(Drain, "DRAM cache controller done draining\n");
+        signalDrainDone();
+    }
+
+    return true;
+}
+
+void
+DRAMCacheCtrl::addWriteBack(Addr blk_addr, const uint8_t *blk_data)
+{
+    RequestPtr req = std::make_shared<Request>(blk_addr, blkSize, 0,
+                                               requestorId);
+    PacketPtr pkt = new Packet(req, MemCmd::WriteReq);
+    pkt->allocate();
+    pkt->setData(blk_data);
+    pkt->pushSenderState(new SenderState(nullptr, Access::WriteBack));
+
+    writeBuffer.push_back(pkt);
+    stats.writeBacks++;
+
+    drainWriteBuffer();
+}
+
+void
+DRAMCacheCtrl::drainWriteBuffer(bool force)
+{
+    // give priority to the reads of the backing memory
+    if (!force && pendingMemReads > 0 && writeBuffer.size() < writeBufferSize)
+        return;
+
+    // once queued in the port, the write backs are sent to the backing
+    // memory ahead of any later read of the same line
+    while (!writeBuffer.empty()) {
+        memSidePort.schedTimingReq(writeBuffer.front(), clockEdge());
+        writeBuffer.pop_front();
+        pendingWriteBacks++;
+    }
+}
+
+PacketPtr
+DRAMCacheCtrl::findWriteBack(Addr blk_addr) const
+{
+    for (auto it = writeBuffer.rbegin(); it != writeBuffer.rend(); ++it) {
+        if ((*it)->getAddr() == blk_addr)
+            return *it;
+    }
+    return nullptr;
+}
+
+unsigned
+DRAMCacheCtrl::findWay(unsigned set, Addr blk_addr) const
+{
+    for (unsigned way = 0; way < assoc; way++) {
+        const TagEntry &entry = tags[set * assoc + way];
+        if (entry.valid && entry.blkAddr == blk_addr)
+            return way;
+    }
+    return assoc;
+}
+
+unsigned
+DRAMCacheCtrl::findVictim(unsigned set) const
+{
+    for (unsigned way = 0; way < assoc; way++) {
+        if (!tags[set * assoc + way].valid)
+            return way;
+    }
+    return recency[set * assoc + assoc - 1];
+}
+
+void
+DRAMCacheCtrl::touch(unsigned set, unsigned way)
+{
+    auto first = recency.begin() + set * assoc;
+    auto pos = std::find(first, first + assoc, way);
+    assert(pos != first + assoc);
+    std::rotate(first, pos, pos + 1);
+}
+
+unsigned
+DRAMCacheCtrl::predictorIndex(const PacketPtr pkt) const
+{
+    const RequestPtr &req = pkt->req;
+    const Addr key = req->hasPC() ? req->getPC() : req->requestorId();
+    return key % predictor.size();
+}
+
+Tick
+DRAMCacheCtrl::sendAtomicAccess(RequestPort &port, MemCmd cmd, Addr addr,
+                                unsigned size, uint8_t *data)
+{
+    RequestPtr req = std::make_shared<Request>(addr, size, 0, requestorId);
+    Packet pkt(req, cmd);
+    pkt.dataStatic(data);
+    return port.sendAtomic(&pkt);
+}
+
+Tick
+DRAMCacheCtrl::recvAtomic(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+    panic_if(!(pkt->isRead() || pkt->isWrite()),
+             "Should only see read and writes at DRAM cache controller\n");
+    panic_if(roundDown(pkt->getAddr() + pkt->getSize() - 1, blkSize) !=
+             pkt->getBlockAddr(blkSize),
+             "%s spans more than one DRAM cache line", pkt->print());
+
+    const Addr blk_addr = pkt->getBlockAddr(blkSize);
+    const unsigned set = setIndex(blk_addr);
+    std::vector<uint8_t> blk_data(blkSize);
+
+    // the tags are read along with the data of the first way
+    Tick latency = sendAtomicAccess(cacheSidePort, MemCmd::ReadReq,
+                                    frameAddr(set, 0), blkSize,
+                                    blk_data.data()) +
+        cyclesToTicks(tagLatency);
+
+    unsigned way = findWay(set, blk_addr);
+    if (way < assoc) {
+        touch(set, way);
+        const Addr addr = frameAddr(set, way) + pkt->getOffset(blkSize);
+        if (pkt->isWrite()) {
+            stats.writeHits++;
+            if (pkt->cmd != MemCmd::WritebackClean)
+                tagEntry(set, way).dirty = true;
+            sendAtomicAccess(cacheSidePort, MemCmd::WriteReq, addr,
+                             pkt->getSize(), pkt->getPtr<uint8_t>());
+        } else {
+            stats.readHits++;
+            if (way == 0) {
+                pkt->setDataFromBlock(blk_data.data(), blkSize);
+            } else {
+                latency += sendAtomicAccess(cacheSidePort, MemCmd::ReadReq,
+                                            addr, pkt->getSize(),
+                                            pkt->getPtr<uint8_t>());
+            }
+        }
+    } else {
+        if (pkt->isWrite())
+            stats.writeMisses++;
+        else
+            stats.readMisses++;
+
+        // write backs and fills are off the critical path
+        way = findVictim(set);
+        TagEntry &entry = tagEntry(set, way);
+        if (entry.valid && entry.dirty) {
+            if (way != 0) {
+                sendAtomicAccess(cacheSidePort, MemCmd::ReadReq,
+                                 frameAddr(set, way), blkSize,
+                                 blk_data.data());
+            }
+            sendAtomicAccess(memSidePort, MemCmd::WriteReq, entry.blkAddr,
+                             blkSize, blk_data.data());
+            stats.writeBacks++;
+        }
+
+        if (PacketPtr wb_pkt = findWriteBack(blk_addr)) {
+            std::memcpy(blk_data.data(), wb_pkt->getConstPtr<uint8_t>(),
+                        blkSize);
+        } else if (!pkt->isWrite() || pkt->getSize() != blkSize ||
+                   pkt->isMaskedWrite()) {
+            latency += sendAtomicAccess(memSidePort, MemCmd::ReadReq,
+                                        blk_addr, blkSize, blk_data.data());
+        }
+
+        if (pkt->isWrite())
+            pkt->writeDataToBlock(blk_data.data(), blkSize);
+        else
+            pkt->setDataFromBlock(blk_data.data(), blkSize);
+
+        sendAtomicAccess(cacheSidePort, MemCmd::WriteReq, frameAddr(set, way),
+                         blkSize, blk_data.data());
+        entry.blkAddr = blk_addr;
+        entry.valid = true;
+        entry.dirty = pkt->isWrite() && pkt->cmd != MemCmd::WritebackClean;
+        touch(set, way);
+    }
+
+    if (pkt->needsResponse())
+        pkt->makeResponse();
+
+    return latency + cyclesToTicks(responseLatency);
+}
+
+void
+DRAMCacheCtrl::recvFunctional(PacketPtr pkt)
+{
+    pkt->pushLabel(name());
+
+    // the buffered requests and the responses are the most recent
+    // versions of the data
+    if (cpuSidePort.trySatisfyFunctional(pkt)) {
+        pkt->popLabel();
+        return;
+    }
+    for (auto it = requestBuffer.rbegin(); it != requestBuffer.rend();
+         ++it) {
+        if (pkt->trySatisfyFunctional(*it)) {
+            pkt->popLabel();
+            return;
+        }
+    }
+
+    const Addr blk_addr = pkt->getBlockAddr(blkSize);
+
+    // writes also update the lines waiting to be filled
+    if (pkt->isWrite()) {
+        for (auto *txn : transactions) {
+            if (!txn->done && txn->memDataReady &&
+                txn->blkAddr == blk_addr) {
+                pkt->writeDataToBlock(txn->data.data(), blkSize);
+            }
+        }
+    }
+
+    const unsigned set = setIndex(blk_addr);
+    const unsigned way = findWay(set, blk_addr);
+    if (way < assoc) {
+        // access the copy of the line in the cache memory
+        RequestPtr req = std::make_shared<Request>(
+            frameAddr(set, way) + pkt->getOffset(blkSize), pkt->getSize(),
+            0, requestorId);
+        Packet cache_pkt(req, pkt->cmd);
+        cache_pkt.dataStatic(pkt->getPtr<uint8_t>());
+        if (!cacheSidePort.trySatisfyFunctional(&cache_pkt))
+            cacheSidePort.sendFunctional(&cache_pkt);
+
+        // writes update the backing memory as well
+        if (pkt->isRead()) {
+            pkt->makeResponse();
+            pkt->popLabel();
+            return;
+        }
+    }
+
+    for (auto it = writeBuffer.rbegin(); it != writeBuffer.rend(); ++it) {
+        if (pkt->trySatisfyFunctional(*it)) {
+            pkt->popLabel();
+            return;
+        }
+    }
+
+    pkt->popLabel();
+
+    if (!memSidePort.trySatisfyFunctional(pkt))
+        memSidePort.sendFunctional(pkt);
+}
+
+bool
+DRAMCacheCtrl::isDrained() const
+{
+    return requestBuffer.empty() && transactions.empty() &&
+        writeBuffer.empty() && pendingWriteBacks == 0;
+}
+
+DrainState
+DRAMCacheCtrl::drain()
+{
+    if (isDrained()) {
+        DPRINTF(Drain, "DRAM cache controller drained\n");
+        return DrainState::Drained;
+    }
+
+    drainWriteBuffer(true);
+    return DrainState::Draining;
+}
+
+DRAMCacheCtrl::CpuSidePort::CpuSidePort(const std::string &_name,
+                                        DRAMCacheCtrl &_ctrl)
+    : QueuedResponsePort(_name, queue), queue(_ctrl, *this), ctrl(_ctrl)
+{
+}
+
+Tick
+DRAMCacheCtrl::CpuSidePort::recvAtomic(PacketPtr pkt)
+{
+    return ctrl.recvAtomic(pkt);
+}
+
+void
+DRAMCacheCtrl::CpuSidePort::recvFunctional(PacketPtr pkt)
+{
+    ctrl.recvFunctional(pkt);
+}
+
+bool
+DRAMCacheCtrl::CpuSidePort::recvTimingReq(PacketPtr pkt)
+{
+    return ctrl.recvTimingReq(pkt);
+}
+
+AddrRangeList
+DRAMCacheCtrl::CpuSidePort::getAddrRanges() const
+{
+    return ctrl.memSidePort.getAddrRanges();
+}
+
+DRAMCacheCtrl::MemSidePort::MemSidePort(const std::string &_name,
+                                        DRAMCacheCtrl &_ctrl)
+    : QueuedRequestPort(_name, queue, snoopRespQueue),
+      queue(_ctrl, *this), snoopRespQueue(_ctrl, *this), ctrl(_ctrl)
+{
+}
+
+bool
+DRAMCacheCtrl::MemSidePort::recvTimingResp(PacketPtr pkt)
+{
+    return ctrl.recvTimingResp(pkt);
+}
+
+void
+DRAMCacheCtrl::MemSidePort::recvRangeChange()
+{
+    // only the ranges of the backing memory are visible
+    if (this == &ctrl.memSidePort)
+        ctrl.cpuSidePort.sendRangeChange();
+}
+
+DRAMCacheCtrl::CtrlStats::CtrlStats(DRAMCacheCtrl &ctrl)
+    : statistics::Group(&ctrl),
+    ADD_STAT(readHits, statistics::units::Count::get(),
+             "Number of reads that hit in the cache"),
+    ADD_STAT(readMisses, statistics::units::Count::get(),
+             "Number of reads that missed in the cache"),
+    ADD_STAT(writeHits, statistics::units::Count::get(),
+             "Number of writes that hit in the cache"),
+    ADD_STAT(writeMisses, statistics::units::Count::get(),
+             "Number of writes that missed in the cache"),
+    ADD_STAT(writeBufferHits, statistics::units::Count::get(),
+             "Number of misses serviced by the write-back buffer"),
+    ADD_STAT(writeBacks, statistics::units::Count::get(),
+             "Number of dirty lines written back to the backing memory"),
+    ADD_STAT(predictedMisses, statistics::units::Count::get(),
+             "Number of reads predicted to miss"),
+    ADD_STAT(wastedMemReads, statistics::units::Count::get(),
+             "Number of reads predicted to miss that hit"),
+    ADD_STAT(serializedMisses, statistics::units::Count::get(),
+             "Number of reads predicted to hit that missed"),
+    ADD_STAT(missLatency, statistics::units::Tick::get(),
+             "Total latency of the misses"),
+    ADD_STAT(hitRate, statistics::units::Ratio::get(),
+             "Fraction of the accesses that hit in the cache",
+             (readHits + writeHits) /
+             (readHits + writeHits + readMisses + writeMisses)),
+    ADD_STAT(avgMissLatency, statistics::units::Rate<
+                statistics::units::Tick, statistics::units::Count>::get(),
+             "Average latency of the misses",
+             missLatency / (readMisses + writeMisses))
+{
+}
+
+void
+DRAMCacheCtrl::CtrlStats::regStats()
+{
+    statistics::Group::regStats();
+
+    hitRate.precision(4);
+    avgMissLatency.precision(2);
+}
+
+} // namespace memory
+} // namespace gem5
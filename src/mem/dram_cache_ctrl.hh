@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * DRAMCacheCtrl declaration
+ */
+
+#ifndef __MEM_DRAM_CACHE_CTRL_HH__
+#define __MEM_DRAM_CACHE_CTRL_HH__
+
+#include <deque>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/packet.hh"
+#include "mem/qport.hh"
+#include "params/DRAMCacheCtrl.hh"
+#include "sim/clocked_object.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * A DRAM cache controller, using a memory, typically a die-stacked HBM
+ * device, as a tagged direct-mapped or set-associative cache of the
+ * lines of a larger backing memory. The cache and the backing memory
+ * are each modelled by their own memory controller, connected to the
+ * cache_side_port and the mem_side_port respectively, so that their
+ * timing is the one of the media interface they use.
+ *
+ * The tags are kept in the DRAM, and every access starts with a read of
+ * the tags of the set. With a direct-mapped cache, the tags and the data
+ * are read with the same burst. With a set-associative cache, the tags
+ * of a set are stored with the data of its first way, and the data of
+ * the other ways is read once the tags have been checked.
+ *
+ * Misses read the line from the backing memory, respond, and fill it in
+ * the cache. A hit/miss predictor, indexed by the PC of the access, or
+ * by its requestor if it has none, lets reads predicted to miss access
+ * the backing memory in parallel with the tag check. Dirty victims are
+ * held in a write-back buffer, which is drained when no reads of the
+ * backing memory are pending or once it is full.
+ *
+ * Accesses to the same set are serialised, in order, and no access may
+ * span more than one cache line. The memory behind the cache_side_port
+ * holds the data of the cache, and should not be part of the system
+ * address map.
+ */
+class DRAMCacheCtrl : public ClockedObject
+{
+  public:
+    PARAMS(DRAMCacheCtrl);
+    DRAMCacheCtrl(const Params &p);
+    ~DRAMCacheCtrl();
+
+    void init() override;
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+    DrainState drain() override;
+
+  protected:
+    class CpuSidePort : public QueuedResponsePort
+    {
+      public:
+        CpuSidePort(const std::string &_name, DRAMCacheCtrl &_ctrl);
+
+      protected:
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        bool recvTimingReq(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+
+      private:
+        RespPacketQueue queue;
+        DRAMCacheCtrl &ctrl;
+    };
+
+    class MemSidePort : public QueuedRequestPort
+    {
+      public:
+        MemSidePort(const std::string &_name, DRAMCacheCtrl &_ctrl);
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvRangeChange() override;
+
+      private:
+        ReqPacketQueue queue;
+        SnoopRespPacketQueue snoopRespQueue;
+        DRAMCacheCtrl &ctrl;
+    };
+
+    /** Kind of the accesses sent to the cache or the backing memory. */
+    enum class Access
+    {
+        TagRead,
+        DataRead,
+        VictimRead,
+        CacheWrite,
+        MemRead,
+        WriteBack
+    };
+
+    /** State of the handling of a request of the cpu side. */
+    struct Transaction
+    {
+        /** The request, nullptr once it has been responded to */
+        PacketPtr pkt;
+        Tick entryTime;
+        Addr blkAddr;
+        unsigned set;
+        /** The way hit, or the way of the victim on a miss */
+        unsigned way;
+        bool hit;
+        /** The read was predicted to miss and went to memory early */
+        bool predictedMiss = false;
+        bool tagDone = false;
+        bool memReadIssued = false;
+        /** Whether data holds the line read from the backing memory */
+        bool memDataReady = false;
+        /** Waiting for the data of the victim to write it back */
+        bool victimPending = false;
+        Addr victimAddr = 0;
+        /** Done with the set, waiting for the outstanding accesses */
+        bool done = false;
+        /** Number of accesses sent and not responded to */
+        unsigned outstanding = 0;
+        std::vector<uint8_t> data;
+    };
+
+    struct SenderState : public Packet::SenderState
+    {
+        SenderState(Transaction *_txn, Access _access)
+            : txn(_txn), access(_access)
+        {}
+        Transaction *txn;
+        Access access;
+    };
+
+    struct TagEntry
+    {
+        Addr blkAddr = 0;
+        bool valid = false;
+        bool dirty = false;
+    };
+
+    /** Handle a request of the cpu side, in timing mode. */
+    bool recvTimingReq(PacketPtr pkt);
+
+    /** Handle a request of the cpu side, in atomic mode. */
+    Tick recvAtomic(PacketPtr pkt);
+
+    /** Handle a functional request of the cpu side. */
+    void recvFunctional(PacketPtr pkt);
+
+    /** Handle a response of the cache or of the backing memory. */
+    bool recvTimingResp(PacketPtr pkt);
+
+    /**
+     * Start the oldest request of the request buffer whose set is not
+     * busy, and any requests to the same set wait for it.
+     */
+    void processNextReqEvent();
+    EventFunctionWrapper nextReqEvent;
+
+    void startTransaction(PacketPtr pkt);
+
+    /** Act on the tags of the set once they have been read. */
+    void tagChecked(Transaction *txn, PacketPtr tag_pkt);
+
+    /**
+     * Respond to a miss and fill the line once the line and the tags
+     * are known, and the victim has been read.
+     */
+    void tryFill(Transaction *txn);
+
+    /**
+     * Release the set of a transaction that is done, once the line has
+     * been read, or written to the cache memory.
+     */
+    void finishTransaction(Transaction *txn);
+
+    /**
+     * Respond to the request of a transaction.
+     *
+     * @param blk_data The data of the line, for reads
+     * @param delay Cycles before the data is available
+     */
+    void respond(Transaction *txn, const uint8_t *blk_data,
+                 Cycles delay=Cycles(0));
+
+    /** Send an access to the cache memory, or to the backing memory. */
+    void sendAccess(Transaction *txn, Access access, Addr addr,
+                    unsigned size, const uint8_t *data, Tick when);
+
+    /** Queue a dirty line for a write back to the backing memory. */
+    void addWriteBack(Addr blk_addr, const uint8_t *blk_data);
+
+    /** Do an atomic access of the cache or of the backing memory. */
+    Tick sendAtomicAccess(RequestPort &port, MemCmd cmd, Addr addr,
+                          unsigned size, uint8_t *data);
+
+    /**
+     * Send the buffered write backs to the backing memory if no reads of
+     * the backing memory are pending, the buffer is full, or if forced.
+     */
+    void drainWriteBuffer(bool force=false);
+
+    /** Find the newest buffered write back of a line. */
+    PacketPtr findWriteBack(Addr blk_addr) const;
+
+    /** Find the way holding a line, or assoc if it is not cached. */
+    unsigned findWay(unsigned set, Addr blk_addr) const;
+
+    /** Choose the way to replace in a set. */
+    unsigned findVictim(unsigned set) const;
+
+    /** Make a way the most recently used of its set. */
+    void touch(unsigned set, unsigned way);
+
+    TagEntry &
+    tagEntry(unsigned set, unsigned way)
+    {
+        return tags[set * assoc + way];
+    }
+
+    unsigned
+    setIndex(Addr blk_addr) const
+    {
+        return (blk_addr / blkSize) % numSets;
+    }
+
+    /** Address in the cache memory of the line of a way. */
+    Addr
+    frameAddr(unsigned set, unsigned way) const
+    {
+        return cacheBase + (Addr(set) * assoc + way) * blkSize;
+    }
+
+    /** Index of the predictor entry used for a read. */
+    unsigned predictorIndex(const PacketPtr pkt) const;
+
+    bool isDrained() const;
+
+    CpuSidePort cpuSidePort;
+    MemSidePort cacheSidePort;
+    MemSidePort memSidePort;
+
+    RequestorID requestorId;
+
+    const unsigned blkSize;
+    const unsigned assoc;
+    const unsigned numSets;
+    const Addr cacheBase;
+    const Cycles tagLatency;
+    const Cycles responseLatency;
+    const unsigned requestBufferSize;
+    const unsigned writeBufferSize;
+
+    std::vector<TagEntry> tags;
+
+    /** Ways of every set, from the most to the least recently used */
+    std::vector<uint8_t> recency;
+
+    /** Hit/miss predictor, empty if disabled */
+    std::vector<SatCounter8> predictor;
+
+    /** Requests waiting for their set, or for the controller */
+    std::deque<PacketPtr> requestBuffer;
+    bool retryReq = false;
+
+    /** Sets with a transaction in progress */
+    std::vector<bool> setBusy;
+
+    /** Transactions in progress, including the done ones */
+    std::unordered_set<Transaction *> transactions;
+
+    /** Write backs not yet sent to the backing memory */
+    std::deque<PacketPtr> writeBuffer;
+
+    /** Reads of the backing memory waiting for their response */
+    unsigned pendingMemReads = 0;
+
+    /** Write backs sent and waiting for their response */
+    unsigned pendingWriteBacks = 0;
+
+    struct CtrlStats : public statistics::Group
+    {
+        CtrlStats(DRAMCacheCtrl &ctrl);
+
+        void regStats() override;
+
+        statistics::Scalar readHits;
+        statistics::Scalar readMisses;
+        statistics::Scalar writeHits;
+        statistics::Scalar writeMisses;
+        statistics::Scalar writeBufferHits;
+        statistics::Scalar writeBacks;
+        statistics::Scalar predictedMisses;
+        statistics::Scalar wastedMemReads;
+        statistics::Scalar serializedMisses;
+        statistics::Scalar missLatency;
+        statistics::Formula hitRate;
+        statistics::Formula avgMissLatency;
+    } stats;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_DRAM_CACHE_CTRL_HH__
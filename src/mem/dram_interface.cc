@@ -40,6 +40,9 @@
 
 #include "mem/dram_interface.hh"
 
+#include <algorithm>
+#include <numeric>
+
 #include "base/bitfield.hh"
 #include "base/cprintf.hh"
 #include "base/trace.hh"
@@ -59,115 +62,116 @@ namespace memory
 std::pair<MemPacketQueue::iterator, Tick>
 DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
 {
-    std::vector<uint32_t> earliest_banks(ranksPerChannel, 0);
+    // Rather than walking the queue, only look at the oldest row hit and
+    // the oldest packet to another row of every bank with queued
+    // packets, using the bank index of the queue. Amongst those, pick
+    // the packet a walk of the queue in order would pick: the oldest
+    // seamless row hit, else the oldest packet to one of the earliest
+    // banks if the bank can be prepped without delay, else the oldest
+    // prepped row hit, else the oldest packet to one of the earliest
+    // banks. All the packets of a queue are either reads or writes, so
+    // the oldest row hit of a bank is also its oldest seamless one
+
+    // oldest row hit that can issue without additional delay, such as
+    // same rank accesses and/or different bank-group accesses
+    MemPacket* seamless_pkt = nullptr;
+
+    // oldest row hit, not seamless, but bank prepped and ready
+    MemPacket* prepped_pkt = nullptr;
+
+    for (int r = 0; r < ranksPerChannel; r++) {
+        // check if rank is not doing a refresh and thus is available,
+        // if not, skip its packets
+        if (!ranks[r]->inRefIdleState()) {
+            DPRINTF(DRAM, "%s Rank %d not available\n", __func__, r);
+            continue;
+        }
 
-    // Has minBankPrep been called to populate earliest_banks?
-    bool filled_earliest_banks = false;
-    // can the PRE/ACT sequence be done without impacting utlization?
-    bool hidden_bank_prep = false;
+        for (int b = 0; b < banksPerRank; b++) {
+            const MemPacketQueue::BankList* bank_pkts =
+                queue.bankPackets(pseudoChannel, r * banksPerRank + b);
+            if (!bank_pkts)
+                continue;
 
-    // search for seamless row hits first, if no seamless row hit is
-    // found then determine if there are other packets that can be issued
-    // without incurring additional bus delay due to bank timing
-    // Will select closed rows first to enable more open row possibilies
-    // in future selections
-    bool found_hidden_bank = false;
-
-    // remember if we found a row hit, not seamless, but bank prepped
-    // and ready
-    bool found_prepped_pkt = false;
-
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
-
-    Tick selected_col_at = MaxTick;
-    auto selected_pkt_it = queue.end();
-
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        MemPacket* pkt = *i;
-
-        // select optimal DRAM packet in Q
-        if (pkt->isDram() && (pkt->pseudoChannel == pseudoChannel)) {
-            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
-
-            DPRINTF(DRAM, "%s checking DRAM packet in bank %d, row %d\n",
-                    __func__, pkt->bank, pkt->row);
-
-            // check if rank is not doing a refresh and thus is available,
-            // if not, jump to the next packet
-            if (burstReady(pkt)) {
-
-                DPRINTF(DRAM,
-                        "%s bank %d - Rank %d available\n", __func__,
-                        pkt->bank, pkt->rank);
-
-                // check if it is a row hit
-                if (bank.openRow == pkt->row) {
-                    // no additional rank-to-rank or same bank-group
-                    // delays, or we switched read/write and might as well
-                    // go for the row hit
-                    if (col_allowed_at <= min_col_at) {
-                        // FCFS within the hits, giving priority to
-                        // commands that can issue seamlessly, without
-                        // additional delay, such as same rank accesses
-                        // and/or different bank-group accesses
-                        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        // no need to look through the remaining queue entries
-                        break;
-                    } else if (!found_hidden_bank && !found_prepped_pkt) {
-                        // if we did not find a packet to a closed row that can
-                        // issue the bank commands without incurring delay, and
-                        // did not yet find a packet to a prepped row, remember
-                        // the current one
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        found_prepped_pkt = true;
-                        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
-                    }
-                } else if (!found_earliest_pkt) {
-                    // if we have not initialised the bank status, do it
-                    // now, and only once per scheduling decisions
-                    if (!filled_earliest_banks) {
-                        // determine entries with earliest bank delay
-                        std::tie(earliest_banks, hidden_bank_prep) =
-                            minBankPrep(queue, min_col_at);
-                        filled_earliest_banks = true;
-                    }
+            const Bank& bank = ranks[r]->banks[b];
+            for (MemPacket* pkt : *bank_pkts) {
+                if (bank.openRow != pkt->row)
+                    continue;
 
-                    // bank is amongst first available banks
-                    // minBankPrep will give priority to packets that can
-                    // issue seamlessly
-                    if (bits(earliest_banks[pkt->rank],
-                             pkt->bank, pkt->bank)) {
-                        found_earliest_pkt = true;
-                        found_hidden_bank = hidden_bank_prep;
-
-                        // give priority to packets that can issue
-                        // bank commands 'behind the scenes'
-                        // any additional delay if any will be due to
-                        // col-to-col command requirements
-                        if (hidden_bank_prep || !found_prepped_pkt) {
-                            selected_pkt_it = i;
-                            selected_col_at = col_allowed_at;
+                const Tick col_allowed_at = pkt->isRead() ?
+                    bank.rdAllowedAt : bank.wrAllowedAt;
+                MemPacket*& oldest = col_allowed_at <= min_col_at ?
+                    seamless_pkt : prepped_pkt;
+                if (!oldest || pkt->queueSeq < oldest->queueSeq)
+                    oldest = pkt;
+                break;
+            }
+        }
+    }
+
+    MemPacket* selected_pkt = seamless_pkt;
+    if (seamless_pkt) {
+        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
+    } else {
+        // determine the banks with the earliest bank delay, minBankPrep
+        // will give priority to banks that can issue seamlessly
+        std::vector<uint32_t> earliest_banks;
+        // can the PRE/ACT sequence be done without impacting utlization?
+        bool hidden_bank_prep;
+        std::tie(earliest_banks, hidden_bank_prep) =
+            minBankPrep(queue, min_col_at);
+
+        // give priority to packets that can issue bank commands 'behind
+        // the scenes', any additional delay if any will be due to
+        // col-to-col command requirements
+        MemPacket* earliest_pkt = nullptr;
+        if (hidden_bank_prep || !prepped_pkt) {
+            for (int r = 0; r < ranksPerChannel; r++) {
+                for (int b = 0; b < banksPerRank; b++) {
+                    if (!bits(earliest_banks[r], b, b))
+                        continue;
+
+                    const Bank& bank = ranks[r]->banks[b];
+                    const MemPacketQueue::BankList* bank_pkts =
+                        queue.bankPackets(pseudoChannel, r * banksPerRank + b);
+                    assert(bank_pkts);
+                    for (MemPacket* pkt : *bank_pkts) {
+                        if (bank.openRow == pkt->row)
+                            continue;
+
+                        if (!earliest_pkt ||
+                            pkt->queueSeq < earliest_pkt->queueSeq) {
+                            earliest_pkt = pkt;
                         }
+                        break;
                     }
                 }
-            } else {
-                DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
-                        pkt->bank, pkt->rank);
             }
         }
+
+        if (earliest_pkt) {
+            selected_pkt = earliest_pkt;
+        } else if (prepped_pkt) {
+            DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
+            selected_pkt = prepped_pkt;
+        }
     }
 
-    if (selected_pkt_it == queue.end()) {
+    if (!selected_pkt) {
         DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+        return std::make_pair(queue.end(), MaxTick);
     }
 
+    DPRINTF(DRAM, "%s selected DRAM packet in bank %d, row %d\n",
+            __func__, selected_pkt->bank, selected_pkt->row);
+
+    const Bank& bank = ranks[selected_pkt->rank]->banks[selected_pkt->bank];
+    const Tick selected_col_at = selected_pkt->isRead() ? bank.rdAllowedAt :
+                                                          bank.wrAllowedAt;
+    auto selected_pkt_it = std::find(queue.begin(), queue.end(),
+                                     selected_pkt);
+    assert(selected_pkt_it != queue.end());
+
     return std::make_pair(selected_pkt_it, selected_col_at);
 }
 
@@ -207,6 +211,9 @@ DRAMInterface::activateBank(Rank& rank_ref, Bank& bank_ref,
     rank_ref.cmdList.push_back(Command(MemCommand::ACT, bank_ref.bank,
                                act_at));
 
+    if (rhMitigation != enums::none)
+        countActivation(rank_ref, bank_ref, act_at, row);
+
     DPRINTF(DRAMPower, "%llu,ACT,%d,%d\n", divCeil(act_at, tCK) -
             timeStampOffset, bank_ref.bank, rank_ref.rank);
 
@@ -313,6 +320,11 @@ DRAMInterface::prechargeBank(Rank& rank_ref, Bank& bank, Tick pre_tick,
 
     bank.actAllowedAt = std::max(bank.actAllowedAt, pre_done_at);
 
+    // a pending Rowhammer mitigation goes ahead as soon as the bank is
+    // closed, the scheduler sees the bank as busy until it is done
+    if (bank.mitigationPending)
+        mitigateBank(rank_ref, bank, pre_done_at);
+
     assert(rank_ref.numBanksActive != 0);
     --rank_ref.numBanksActive;
 
@@ -343,6 +355,62 @@ DRAMInterface::prechargeBank(Rank& rank_ref, Bank& bank, Tick pre_tick,
     }
 }
 
+void
+DRAMInterface::countActivation(Rank& rank_ref, Bank& bank_ref,
+                               Tick act_tick, uint32_t row)
+{
+    if (rhMitigation == enums::rfm) {
+        // the rolling accumulated activations of the bank call for an
+        // RFM once they reach the management threshold
+        if (++bank_ref.raaCount >= rhThreshold)
+            bank_ref.mitigationPending = true;
+        return;
+    }
+
+    uint32_t &row_acts = bank_ref.rowActs[row];
+    if (++row_acts < rhThreshold)
+        return;
+
+    if (rhMitigation == enums::trr) {
+        // refresh the neighbours of the aggressor row
+        DPRINTF(DRAM, "Row %d of bank %d, rank %d is an aggressor\n", row,
+                bank_ref.bank, rank_ref.rank);
+        row_acts = 0;
+        bank_ref.mitigationPending = true;
+    } else if (!rank_ref.backOffEvent.scheduled()) {
+        // PRAC alert, normal operation continues for tABO_ACT before
+        // the rank has to back off, the counter is only cleared by the
+        // RFMs
+        DPRINTF(DRAM, "Row %d of bank %d, rank %d raised an alert\n", row,
+                bank_ref.bank, rank_ref.rank);
+        schedule(rank_ref.backOffEvent, act_tick + tABO);
+    }
+}
+
+void
+DRAMInterface::mitigateBank(Rank& rank_ref, Bank& bank_ref,
+                            Tick mitigate_at)
+{
+    if (rhMitigation == enums::rfm) {
+        bank_ref.raaCount -= std::min(bank_ref.raaCount, rhThreshold);
+        bank_ref.mitigationPending = bank_ref.raaCount >= rhThreshold;
+    } else {
+        bank_ref.mitigationPending = false;
+    }
+
+    bank_ref.actAllowedAt = std::max(bank_ref.actAllowedAt, mitigate_at) +
+        tRFM;
+
+    // the energy is approximated by that of a bank refresh
+    rank_ref.cmdList.push_back(Command(MemCommand::REFB, bank_ref.bank,
+                               mitigate_at));
+    DPRINTF(DRAMPower, "%llu,REFB,%d,%d\n", divCeil(mitigate_at, tCK) -
+            timeStampOffset, bank_ref.bank, rank_ref.rank);
+
+    stats.rhMitigations++;
+    stats.rhMitigationTime += tRFM;
+}
+
 std::pair<Tick, Tick>
 DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
                              const std::vector<MemPacketQueue>& queue)
@@ -377,6 +445,7 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
 
         // If there is a page open, precharge it.
         if (bank_ref.openRow != Bank::NO_ROW) {
+            stats.perBankRowConflicts[mem_pkt->bankId]++;
             prechargeBank(rank_ref, bank_ref, std::max(bank_ref.preAllowedAt,
                                                    curTick()));
         }
@@ -643,17 +712,27 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
       tCCD_L_WR(_p.tCCD_L_WR), tCCD_L(_p.tCCD_L),
       tRCD_RD(_p.tRCD), tRCD_WR(_p.tRCD_WR),
       tRP(_p.tRP), tRAS(_p.tRAS), tWR(_p.tWR), tRTP(_p.tRTP),
-      tRFC(_p.tRFC), tREFI(_p.tREFI), tRRD(_p.tRRD), tRRD_L(_p.tRRD_L),
+      tRFC(_p.tRFC), tREFI(_p.tREFI), tRFCsb(_p.tRFCsb),
+      tREFIsb(_p.refresh_mode != enums::all_bank && _p.tREFIsb ?
+              _p.tREFIsb : _p.tREFI),
+      tRRD(_p.tRRD), tRRD_L(_p.tRRD_L),
       tPPD(_p.tPPD), tAAD(_p.tAAD),
       tXAW(_p.tXAW), tXP(_p.tXP), tXS(_p.tXS),
       clkResyncDelay(_p.tBURST_MAX),
-      dataClockSync(_p.data_clock_sync),
+      dataClockSync(_p.data_clock_sync && !_p.wck_always_on),
+      refreshMode(_p.refresh_mode),
+      refreshSets(_p.refresh_mode == enums::per_bank ? _p.banks_per_rank :
+                  _p.refresh_mode == enums::same_bank ?
+                  _p.banks_per_rank / std::max(_p.bank_groups_per_rank, 1U) :
+                  1),
       burstInterleave(tBURST != tBURST_MIN),
       twoCycleActivate(_p.two_cycle_activate),
       activationLimit(_p.activation_limit),
       wrToRdDlySameBG(tWL + _p.tBURST_MAX + _p.tWTR_L),
       rdToWrDlySameBG(_p.tRTW + _p.tBURST_MAX),
       pageMgmt(_p.page_policy),
+      rhMitigation(_p.rowhammer_mitigation), rhThreshold(_p.rh_threshold),
+      tRFM(_p.tRFM), pracRFMs(_p.prac_rfms), tABO(_p.tABO_ACT),
       maxAccessesPerRow(_p.max_accesses_per_row),
       timeStampOffset(0), activeRank(0),
       enableDRAMPowerdown(_p.enable_dram_powerdown),
@@ -696,12 +775,53 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
 
     rowsPerBank = capacity / (rowBufferSize * banksPerRank * ranksPerChannel);
 
+    // the programmable address mapping has to produce every field in
+    // full, so each of them needs a power of two range
+    const unsigned bank_groups = bankGroupArch ? bankGroupsPerRank : 1;
+    const int rank_bits = ceilLog2(ranksPerChannel);
+    const int bank_group_bits = ceilLog2(bank_groups);
+    const int bank_bits = ceilLog2(banksPerRank / bank_groups);
+    const int row_bits = ceilLog2(rowsPerBank);
+    fatal_if(!_p.rank_masks.empty() &&
+             int(_p.rank_masks.size()) != rank_bits,
+             "%s: %d rank masks needed\n", name(), rank_bits);
+    fatal_if(!_p.bank_group_masks.empty() && (!isPowerOf2(bank_groups) ||
+             int(_p.bank_group_masks.size()) != bank_group_bits),
+             "%s: bank group masks need a power of two number of bank "
+             "groups, one mask per bank group bit\n", name());
+    fatal_if(!_p.bank_masks.empty() &&
+             (!isPowerOf2(banksPerRank / bank_groups) ||
+              int(_p.bank_masks.size()) != bank_bits),
+             "%s: bank masks need a power of two number of banks per bank "
+             "group, one mask per bank bit\n", name());
+    fatal_if(!_p.row_masks.empty() && (!isPowerOf2(rowsPerBank) ||
+             int(_p.row_masks.size()) != row_bits),
+             "%s: %d row masks needed\n", name(), row_bits);
+
+    addrMap = {addrMapping, burstSize, burstsPerRowBuffer, burstsPerStripe,
+               ranksPerChannel, banksPerRank, bank_groups, rowsPerBank,
+               _p.rank_masks, _p.bank_group_masks, _p.bank_masks,
+               _p.row_masks};
+
     // some basic sanity checks
     if (tREFI <= tRP || tREFI <= tRFC) {
         fatal("tREFI (%d) must be larger than tRP (%d) and tRFC (%d)\n",
               tREFI, tRP, tRFC);
     }
 
+    fatal_if(rhMitigation != enums::none && (rhThreshold == 0 || tRFM == 0),
+             "%s: Rowhammer mitigation needs a threshold and tRFM\n",
+             name());
+
+    if (refreshMode != enums::all_bank) {
+        fatal_if(tRFCsb == 0, "tRFCsb must be set for same-bank and "
+                 "per-bank refresh\n");
+        fatal_if(refreshMode == enums::same_bank && !bankGroupArch,
+                 "Same-bank refresh requires bank groups\n");
+        fatal_if(tREFIsb / refreshSets <= tRP, "tREFIsb (%d) is too short "
+                 "to refresh %d bank sets\n", tREFIsb, refreshSets);
+    }
+
     // basic bank group architecture checks ->
     if (bankGroupArch) {
         // must have at least one bank per bank group
@@ -835,70 +955,14 @@ MemPacket*
 DRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
                        unsigned size, bool is_read, uint8_t pseudo_channel)
 {
-    // decode the address based on the address mapping scheme, with
-    // Ro, Ra, Co, Ba and Ch denoting row, rank, column, bank and
-    // channel, respectively
+    // decode the address based on the address mapping scheme, the
+    // channel bits being removed from the address first
     uint8_t rank;
     uint8_t bank;
     // use a 64-bit unsigned during the computations as the row is
     // always the top bits, and check before creating the packet
     uint64_t row;
-
-    // Get packed address, starting at 0
-    Addr addr = getCtrlAddr(pkt_addr);
-
-    // truncate the address to a memory burst, which makes it unique to
-    // a specific buffer, row, bank, rank and channel
-    addr = addr / burstSize;
-
-    // we have removed the lowest order address bits that denote the
-    // position within the column
-    if (addrMapping == enums::RoRaBaChCo || addrMapping == enums::RoRaBaCoCh) {
-        // the lowest order bits denote the column to ensure that
-        // sequential cache lines occupy the same row
-        addr = addr / burstsPerRowBuffer;
-
-        // after the channel bits, get the bank bits to interleave
-        // over the banks
-        bank = addr % banksPerRank;
-        addr = addr / banksPerRank;
-
-        // after the bank, we get the rank bits which thus interleaves
-        // over the ranks
-        rank = addr % ranksPerChannel;
-        addr = addr / ranksPerChannel;
-
-        // lastly, get the row bits, no need to remove them from addr
-        row = addr % rowsPerBank;
-    } else if (addrMapping == enums::RoCoRaBaCh) {
-        // with emerging technologies, could have small page size with
-        // interleaving granularity greater than row buffer
-        if (burstsPerStripe > burstsPerRowBuffer) {
-            // remove column bits which are a subset of burstsPerStripe
-            addr = addr / burstsPerRowBuffer;
-        } else {
-            // remove lower column bits below channel bits
-            addr = addr / burstsPerStripe;
-        }
-
-        // start with the bank bits, as this provides the maximum
-        // opportunity for parallelism between requests
-        bank = addr % banksPerRank;
-        addr = addr / banksPerRank;
-
-        // next get the rank bits
-        rank = addr % ranksPerChannel;
-        addr = addr / ranksPerChannel;
-
-        // next, the higher-order column bites
-        if (burstsPerStripe < burstsPerRowBuffer) {
-            addr = addr / (burstsPerRowBuffer / burstsPerStripe);
-        }
-
-        // lastly, get the row bits, no need to remove them from addr
-        row = addr % rowsPerBank;
-    } else
-        panic("Unknown address mapping policy chosen!");
+    addrMap.decode(getCtrlAddr(pkt_addr), pkt_addr, rank, bank, row);
 
     assert(rank < ranksPerChannel);
     assert(bank < banksPerRank);
@@ -1038,16 +1102,6 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // delay on the data bus
     bool hidden_bank_prep = false;
 
-    // determine if we have queued transactions targetting the
-    // bank in question
-    std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
-            continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
-    }
-
     // Find command with optimal bank timing
     // Will prioritize commands that can issue seamlessly.
     for (int i = 0; i < ranksPerChannel; i++) {
@@ -1055,10 +1109,10 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
             uint16_t bank_id = i * banksPerRank + j;
 
             // if we have waiting requests for the bank, and it is
-            // amongst the first available, update the mask
-            if (got_waiting[bank_id]) {
-                // make sure this rank is not currently refreshing.
-                assert(ranks[i]->inRefIdleState());
+            // amongst the first available, update the mask, banks of
+            // a rank that is currently refreshing are not considered
+            if (ranks[i]->inRefIdleState() &&
+                queue.bankPackets(pseudoChannel, bank_id)) {
                 // simplistic approximation of when the bank can issue
                 // an activate, ignoring any rank-to-rank switching
                 // cost in this calculation
@@ -1119,7 +1173,8 @@ DRAMInterface::Rank::Rank(const DRAMInterfaceParams &_p,
                          int _rank, DRAMInterface& _dram)
     : EventManager(&_dram), dram(_dram),
       pwrStateTrans(PWR_IDLE), pwrStatePostRefresh(PWR_IDLE),
-      pwrStateTick(0), refreshDueAt(0), pwrState(PWR_IDLE),
+      pwrStateTick(0), refreshDueAt(0), refreshSet(0), refreshesInWindow(0),
+      pwrState(PWR_IDLE),
       refreshState(REF_IDLE), inLowPowerState(false), rank(_rank),
       readEntries(0), writeEntries(0), outstandingEvents(0),
       wakeUpAllowedAt(0), power(_p, false), banks(_p.banks_per_rank),
@@ -1130,6 +1185,7 @@ DRAMInterface::Rank::Rank(const DRAMInterfaceParams &_p,
       refreshEvent([this]{ processRefreshEvent(); }, name()),
       powerEvent([this]{ processPowerEvent(); }, name()),
       wakeUpEvent([this]{ processWakeUpEvent(); }, name()),
+      backOffEvent([this]{ processBackOffEvent(); }, name()),
       stats(_dram, *this)
 {
     for (int b = 0; b < _p.banks_per_rank; b++) {
@@ -1169,6 +1225,8 @@ void
 DRAMInterface::Rank::suspend()
 {
     deschedule(refreshEvent);
+    if (backOffEvent.scheduled())
+        deschedule(backOffEvent);
 
     // Update the stats
     updatePowerStats();
@@ -1286,6 +1344,15 @@ DRAMInterface::Rank::processWriteDoneEvent()
 void
 DRAMInterface::Rank::processRefreshEvent()
 {
+    // same-bank and per-bank refreshes leave the rest of the rank
+    // available, a sleeping rank is woken up and given an all-bank
+    // refresh instead, which covers a whole rotation of bank sets
+    if ((dram.refreshMode != enums::all_bank) &&
+        (refreshState == REF_IDLE) && !inLowPowerState) {
+        refreshBankSet();
+        return;
+    }
+
     // when first preparing the refresh, remember when it was due
     if ((refreshState == REF_IDLE) || (refreshState == REF_SREF_EXIT)) {
         // remember when the refresh is due
@@ -1410,6 +1477,9 @@ DRAMInterface::Rank::processRefreshEvent()
             b.actAllowedAt = ref_done_at;
         }
 
+        if (dram.rhMitigation != enums::none)
+            rowhammerRefresh(0, banks.size());
+
         // at the moment this affects all ranks
         cmdList.push_back(Command(MemCommand::REF, 0, curTick()));
 
@@ -1419,8 +1489,9 @@ DRAMInterface::Rank::processRefreshEvent()
         DPRINTF(DRAMPower, "%llu,REF,0,%d\n", divCeil(curTick(), dram.tCK) -
                 dram.timeStampOffset, rank);
 
-        // Update for next refresh
-        refreshDueAt += dram.tREFI;
+        // Update for next refresh, restarting any bank set rotation
+        refreshDueAt += dram.tREFIsb;
+        refreshSet = 0;
 
         // make sure we did not wait so long that we cannot make up
         // for it
@@ -1488,6 +1559,123 @@ DRAMInterface::Rank::processRefreshEvent()
     }
 }
 
+void
+DRAMInterface::Rank::refreshBankSet()
+{
+    refreshDueAt = curTick();
+
+    // bank groups are assigned round robin, so the banks with the same
+    // index in every bank group are consecutive bank numbers
+    const unsigned set_size = dram.banksPerRank / dram.refreshSets;
+    const auto first = banks.begin() + refreshSet * set_size;
+    const auto last = first + set_size;
+
+    // close the open banks of the set as soon as they allow it, the
+    // refresh starts once all of them are precharged
+    Tick ref_at = curTick();
+    for (auto b = first; b != last; ++b) {
+        if (b->openRow != Bank::NO_ROW) {
+            dram.prechargeBank(*this, *b,
+                               std::max(b->preAllowedAt, curTick()));
+        }
+        ref_at = std::max(ref_at, b->actAllowedAt);
+    }
+
+    Tick ref_done_at = ref_at + dram.tRFCsb;
+
+    for (auto b = first; b != last; ++b) {
+        b->actAllowedAt = ref_done_at;
+
+        cmdList.push_back(Command(MemCommand::REFB, b->bank, ref_at));
+        DPRINTF(DRAMPower, "%llu,REFB,%d,%d\n", divCeil(ref_at, dram.tCK) -
+                dram.timeStampOffset, b->bank, rank);
+    }
+
+    DPRINTF(DRAMState, "Refreshing banks %d to %d of rank %d until %llu\n",
+            first->bank, (last - 1)->bank, rank, ref_done_at);
+
+    if (dram.rhMitigation != enums::none)
+        rowhammerRefresh(refreshSet * set_size, set_size);
+
+    // update the power stats once per rotation, as an all-bank refresh
+    // would
+    refreshSet = (refreshSet + 1) % dram.refreshSets;
+    if (refreshSet == 0)
+        updatePowerStats();
+
+    refreshDueAt += dram.tREFIsb / dram.refreshSets;
+    schedule(refreshEvent, refreshDueAt);
+}
+
+void
+DRAMInterface::Rank::rowhammerRefresh(unsigned first, unsigned num_banks)
+{
+    // a refresh also counts as a management action for the rolling
+    // accumulated activations
+    for (unsigned b = first; b < first + num_banks; b++) {
+        banks[b].raaCount -= std::min(banks[b].raaCount, dram.rhThreshold);
+    }
+
+    // all rows have been refreshed once the window is over, at which
+    // point the row counters start anew, a whole rotation of bank set
+    // refreshes counting as one refresh
+    if (first + num_banks < banks.size() ||
+        ++refreshesInWindow < REFRESHES_PER_WINDOW)
+        return;
+
+    refreshesInWindow = 0;
+    for (auto &b : banks) {
+        b.rowActs.clear();
+    }
+}
+
+void
+DRAMInterface::Rank::processBackOffEvent()
+{
+    if (inLowPowerState) {
+        if (pwrStateTrans == PWR_SREF) {
+            // the rank is refreshing itself, and cannot be sent RFMs
+            return;
+        }
+        scheduleWakeUpEvent(dram.tXP);
+    }
+
+    // close all banks as soon as they allow it, the RFMs start once
+    // all of them are precharged
+    Tick rfm_at = curTick();
+    for (auto &b : banks) {
+        if (b.openRow != Bank::NO_ROW) {
+            dram.prechargeBank(*this, b, std::max(b.preAllowedAt, curTick()),
+                               true);
+        }
+        rfm_at = std::max(rfm_at, b.actAllowedAt);
+    }
+
+    Tick rfm_done_at = rfm_at + dram.pracRFMs * dram.tRFM;
+
+    for (auto &b : banks) {
+        b.actAllowedAt = rfm_done_at;
+
+        // the RFMs mitigate the rows that raised an alert
+        for (auto row = b.rowActs.begin(); row != b.rowActs.end(); ) {
+            if (row->second >= dram.rhThreshold)
+                row = b.rowActs.erase(row);
+            else
+                ++row;
+        }
+
+        for (Tick t = rfm_at; t < rfm_done_at; t += dram.tRFM) {
+            cmdList.push_back(Command(MemCommand::REFB, b.bank, t));
+        }
+    }
+
+    DPRINTF(DRAMState, "Rank %d backing off until %llu\n", rank,
+            rfm_done_at);
+
+    dram.stats.rhMitigations++;
+    dram.stats.rhMitigationTime += (rfm_done_at - rfm_at) * banks.size();
+}
+
 void
 DRAMInterface::Rank::schedulePowerEvent(PowerState pwr_state, Tick tick)
 {
@@ -1786,7 +1974,11 @@ DRAMInterface::Rank::updatePowerStats()
     stats.preEnergy += energy.pre_energy * dram.devicesPerRank;
     stats.readEnergy += energy.read_energy * dram.devicesPerRank;
     stats.writeEnergy += energy.write_energy * dram.devicesPerRank;
-    stats.refreshEnergy += energy.ref_energy * dram.devicesPerRank;
+    // same-bank and per-bank refreshes are accounted per bank
+    double refb_energy = std::accumulate(energy.refb_energy_banks.begin(),
+                                         energy.refb_energy_banks.end(), 0.0);
+    stats.refreshEnergy += (energy.ref_energy + refb_energy) *
+        dram.devicesPerRank;
     stats.actBackEnergy += energy.act_stdby_energy * dram.devicesPerRank;
     stats.preBackEnergy += energy.pre_stdby_energy * dram.devicesPerRank;
     stats.actPowerDownEnergy += energy.f_act_pd_energy * dram.devicesPerRank;
@@ -1855,6 +2047,15 @@ DRAMInterface::DRAMStats::DRAMStats(DRAMInterface &_dram)
              "Per bank write bursts"),
     ADD_STAT(perBankWrBursts, statistics::units::Count::get(),
              "Per bank write bursts"),
+    ADD_STAT(perBankRowConflicts, statistics::units::Count::get(),
+             "Per bank bursts that found another row open"),
+    ADD_STAT(perBankConflictRate, statistics::units::Ratio::get(),
+             "Per bank fraction of bursts that found another row open"),
+    ADD_STAT(rhMitigations, statistics::units::Count::get(),
+             "Number of Rowhammer mitigations (RFM, targeted refresh or "
+             "PRAC back-off)"),
+    ADD_STAT(rhMitigationTime, statistics::units::Tick::get(),
+             "Total bank time blocked by Rowhammer mitigations"),
 
     ADD_STAT(totQLat, statistics::units::Tick::get(),
              "Total ticks spent queuing"),
@@ -1927,6 +2128,10 @@ DRAMInterface::DRAMStats::regStats()
 
     perBankRdBursts.init(dram.banksPerRank * dram.ranksPerChannel);
     perBankWrBursts.init(dram.banksPerRank * dram.ranksPerChannel);
+    perBankRowConflicts.init(dram.banksPerRank * dram.ranksPerChannel);
+    perBankConflictRate.precision(2);
+    perBankConflictRate = perBankRowConflicts /
+        (perBankRdBursts + perBankWrBursts);
 
     bytesPerActivate
         .init(dram.maxAccessesPerRow ?
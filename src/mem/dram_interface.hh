@@ -46,6 +46,10 @@
 #ifndef __DRAM_INTERFACE_HH__
 #define __DRAM_INTERFACE_HH__
 
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "mem/dram_addr_map.hh"
 #include "mem/drampower.hh"
 #include "mem/mem_interface.hh"
 #include "params/DRAMInterface.hh"
@@ -256,6 +260,19 @@ class DRAMInterface : public MemInterface
          */
         Tick refreshDueAt;
 
+        /**
+         * Index of the bank set to refresh next, only used with
+         * same-bank and per-bank refresh.
+         */
+        unsigned refreshSet;
+
+        /**
+         * Number of refreshes (or rotations of bank set refreshes) in
+         * the current refresh window, after which every row has been
+         * refreshed and the Rowhammer row counters start anew.
+         */
+        uint32_t refreshesInWindow;
+
         /**
          * Function to update Power Stats
          */
@@ -454,6 +471,23 @@ class DRAMInterface : public MemInterface
          */
         void scheduleWakeUpEvent(Tick exit_delay);
 
+        /**
+         * Refresh the next bank set of a same-bank or per-bank refresh
+         * rotation. Open banks in the set are precharged and the set is
+         * blocked for tRFCsb, while the rest of the rank keeps serving
+         * requests, so the refresh state machine is not involved.
+         */
+        void refreshBankSet();
+
+        /**
+         * Account for the refresh of a range of banks in the Rowhammer
+         * activation counters.
+         *
+         * @param first The first bank refreshed
+         * @param num_banks The number of banks refreshed
+         */
+        void rowhammerRefresh(unsigned first, unsigned num_banks);
+
         void processWriteDoneEvent();
         EventFunctionWrapper writeDoneEvent;
 
@@ -472,6 +506,13 @@ class DRAMInterface : public MemInterface
         void processWakeUpEvent();
         EventFunctionWrapper wakeUpEvent;
 
+        /**
+         * PRAC back-off, closing all banks and issuing the RFMs that
+         * mitigate the rows that raised an alert.
+         */
+        void processBackOffEvent();
+        EventFunctionWrapper backOffEvent;
+
       protected:
         RankStats stats;
     };
@@ -512,6 +553,12 @@ class DRAMInterface : public MemInterface
     const Tick tRTP;
     const Tick tRFC;
     const Tick tREFI;
+    const Tick tRFCsb;
+    /**
+     * Interval in which every bank set is refreshed with same-bank or
+     * per-bank refresh, tREFI if unset or with all-bank refresh.
+     */
+    const Tick tREFIsb;
     const Tick tRRD;
     const Tick tRRD_L;
     const Tick tPPD;
@@ -521,6 +568,13 @@ class DRAMInterface : public MemInterface
     const Tick tXS;
     const Tick clkResyncDelay;
     const bool dataClockSync;
+    const enums::RefreshMode refreshMode;
+
+    /**
+     * Number of bank sets refreshed in turn during each tREFIsb, one set
+     * being all the banks for an all-bank refresh.
+     */
+    const uint32_t refreshSets;
     const bool burstInterleave;
     const uint8_t twoCycleActivate;
     const uint32_t activationLimit;
@@ -529,6 +583,30 @@ class DRAMInterface : public MemInterface
 
 
     enums::PageManage pageMgmt;
+
+    /**
+     * Address mapping, including the programmable XOR mapping, set up
+     * once the number of rows per bank is known.
+     */
+    DRAMAddrMap addrMap;
+
+    /**
+     * Rowhammer mitigation, with the activation threshold triggering
+     * it, the time a mitigation blocks a bank, and for PRAC the number
+     * of RFMs and the delay of a back-off.
+     */
+    const enums::RowhammerMitigation rhMitigation;
+    const uint32_t rhThreshold;
+    const Tick tRFM;
+    const uint32_t pracRFMs;
+    const Tick tABO;
+
+    /**
+     * Number of refreshes in a refresh window (tREFW), in which every
+     * row is refreshed once.
+     */
+    static const uint32_t REFRESHES_PER_WINDOW = 8192;
+
     /**
      * Max column accesses (read and write) per row, before forefully
      * closing it.
@@ -576,6 +654,30 @@ class DRAMInterface : public MemInterface
                        Tick pre_tick, bool auto_or_preall = false,
                        bool trace = true);
 
+    /**
+     * Count an activation for the Rowhammer mitigation, flagging the
+     * bank for a mitigation or raising a PRAC alert when the
+     * threshold is reached.
+     *
+     * @param rank_ref The rank of the activation
+     * @param bank_ref The bank of the activation
+     * @param act_tick Time when the activation takes place
+     * @param row Index of the row
+     */
+    void countActivation(Rank& rank_ref, Bank& bank_ref, Tick act_tick,
+                         uint32_t row);
+
+    /**
+     * Issue the pending Rowhammer mitigation of a bank, an RFM or the
+     * refresh of the neighbours of an aggressor row, which blocks the
+     * bank for tRFM.
+     *
+     * @param rank_ref The rank of the bank
+     * @param bank_ref The bank to mitigate
+     * @param mitigate_at Time when the bank is precharged
+     */
+    void mitigateBank(Rank& rank_ref, Bank& bank_ref, Tick mitigate_at);
+
     struct DRAMStats : public statistics::Group
     {
         DRAMStats(DRAMInterface &dram);
@@ -593,6 +695,14 @@ class DRAMInterface : public MemInterface
         statistics::Vector perBankRdBursts;
         statistics::Vector perBankWrBursts;
 
+        /** Per bank bursts that found another row open */
+        statistics::Vector perBankRowConflicts;
+        statistics::Formula perBankConflictRate;
+
+        /** Rowhammer mitigations and the bank time they took */
+        statistics::Scalar rhMitigations;
+        statistics::Scalar rhMitigationTime;
+
         // Latencies summed over all requests
         statistics::Scalar totQLat;
         statistics::Scalar totBusLat;
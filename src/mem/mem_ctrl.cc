@@ -57,6 +57,33 @@ namespace gem5
 namespace memory
 {
 
+void
+MemPacketQueue::push_back(MemPacket* pkt)
+{
+    std::deque<MemPacket*>::push_back(pkt);
+    pkt->queueSeq = nextSeq++;
+
+    if (!pkt->isDram())
+        return;
+
+    if (bankIndex.size() <= pkt->pseudoChannel)
+        bankIndex.resize(pkt->pseudoChannel + 1);
+    auto& banks = bankIndex[pkt->pseudoChannel];
+    if (banks.size() <= pkt->bankId)
+        banks.resize(pkt->bankId + 1);
+    BankList& bank_pkts = banks[pkt->bankId];
+    pkt->bankIter = bank_pkts.insert(bank_pkts.end(), pkt);
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::erase(iterator pos)
+{
+    MemPacket* pkt = *pos;
+    if (pkt->isDram())
+        bankIndex[pkt->pseudoChannel][pkt->bankId].erase(pkt->bankIter);
+    return std::deque<MemPacket*>::erase(pos);
+}
+
 MemCtrl::MemCtrl(const MemCtrlParams &p) :
     qos::MemCtrl(p),
     port(name() + ".port", *this), isTimingMode(false),
@@ -486,7 +513,7 @@ MemCtrl::recvTimingReq(PacketPtr pkt)
 
 void
 MemCtrl::processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        std::deque<MemPacket*>& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req)
 {
@@ -879,7 +906,7 @@ MemCtrl::nonDetermReads(MemInterface* mem_intr) {
 
 void
 MemCtrl::processNextReqEvent(MemInterface* mem_intr,
-                        MemPacketQueue& resp_queue,
+                        std::deque<MemPacket*>& resp_queue,
                         EventFunctionWrapper& resp_event,
                         EventFunctionWrapper& next_req_event,
                         bool& retry_wr_req) {
@@ -47,6 +47,7 @@
 #define __MEM_CTRL_HH__
 
 #include <deque>
+#include <list>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -156,6 +157,18 @@ class MemPacket
      */
     uint8_t _qosValue;
 
+    /**
+     * Position of the packet in the order of the queue holding it, set
+     * when the packet is appended to a MemPacketQueue
+     */
+    uint64_t queueSeq = 0;
+
+    /**
+     * Iterator to the packet in the bank index of the queue holding it,
+     * only valid for DRAM packets
+     */
+    std::list<MemPacket*>::iterator bankIter;
+
     /**
      * Set the packet QoS value
      * (interface compatibility with Packet)
@@ -215,9 +228,54 @@ class MemPacket
 
 };
 
-// The memory packets are store in a multiple dequeue structure,
-// based on their QoS priority
-typedef std::deque<MemPacket*> MemPacketQueue;
+/**
+ * The memory packets are stored in a multiple dequeue structure, based
+ * on their QoS priority. On top of the queue order, each queue indexes
+ * its DRAM packets per pseudo channel and bank, so that the FR-FCFS
+ * scheduler only has to look at the oldest packets of every bank rather
+ * than walk the whole queue.
+ *
+ * Packets are only ever appended, so the bank lists are in queue order,
+ * and the sequence number of the packets orders packets of different
+ * banks. Only push_back() and erase() keep the index up to date, and the
+ * queue must not be modified in any other way.
+ */
+class MemPacketQueue : public std::deque<MemPacket*>
+{
+  public:
+    typedef std::list<MemPacket*> BankList;
+
+    /** Appends a packet to the queue and to the list of its bank. */
+    void push_back(MemPacket* pkt);
+
+    /** Removes a packet from the queue and from the list of its bank. */
+    iterator erase(iterator pos);
+
+    /**
+     * Get the DRAM packets of a bank, oldest first.
+     *
+     * @param pseudo_channel The pseudo channel of the bank
+     * @param bank_id The bank id within the pseudo channel
+     * @return The packets of the bank, or nullptr if there are none
+     */
+    const BankList*
+    bankPackets(uint8_t pseudo_channel, uint16_t bank_id) const
+    {
+        if (pseudo_channel >= bankIndex.size() ||
+            bank_id >= bankIndex[pseudo_channel].size() ||
+            bankIndex[pseudo_channel][bank_id].empty()) {
+            return nullptr;
+        }
+        return &bankIndex[pseudo_channel][bank_id];
+    }
+
+  private:
+    /** DRAM packets per pseudo channel and bank id, in queue order */
+    std::vector<std::vector<BankList>> bankIndex;
+
+    /** Sequence number of the next appended packet */
+    uint64_t nextSeq = 0;
+};
 
 
 /**
@@ -300,14 +358,14 @@ class MemCtrl : public qos::MemCtrl
      * in these methods
      */
     virtual void processNextReqEvent(MemInterface* mem_intr,
-                          MemPacketQueue& resp_queue,
+                          std::deque<MemPacket*>& resp_queue,
                           EventFunctionWrapper& resp_event,
                           EventFunctionWrapper& next_req_event,
                           bool& retry_wr_req);
     EventFunctionWrapper nextReqEvent;
 
     virtual void processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        std::deque<MemPacket*>& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req);
     EventFunctionWrapper respondEvent;
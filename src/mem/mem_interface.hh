@@ -48,6 +48,7 @@
 
 #include <deque>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -101,10 +102,20 @@ class MemInterface : public AbstractMemory
         uint32_t rowAccesses;
         uint32_t bytesAccessed;
 
+        /**
+         * Rowhammer tracking: the rolling accumulated activations of the
+         * bank, the activations of each row, and whether a mitigation is
+         * to be issued when the bank is next precharged.
+         */
+        uint32_t raaCount;
+        std::unordered_map<uint32_t, uint32_t> rowActs;
+        bool mitigationPending;
+
         Bank() :
             openRow(NO_ROW), bank(0), bankgr(0),
             rdAllowedAt(0), wrAllowedAt(0), preAllowedAt(0), actAllowedAt(0),
-            rowAccesses(0), bytesAccessed(0)
+            rowAccesses(0), bytesAccessed(0), raaCount(0),
+            mitigationPending(false)
         { }
     };
 
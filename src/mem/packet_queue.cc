@@ -51,7 +51,8 @@ PacketQueue::PacketQueue(EventManager& _em, const std::string& _label,
                          const std::string& _sendEventName,
                          bool force_order,
                          bool disable_sanity_check)
-    : em(_em), sendEvent([this]{ processSendEvent(); }, _sendEventName),
+    : transmitList(16), transmitHead(0), transmitSize(0),
+      em(_em), sendEvent([this]{ processSendEvent(); }, _sendEventName),
       _disableSanityCheck(disable_sanity_check),
       forceOrder(force_order),
       label(_label), waitingOnRetry(false)
@@ -71,13 +72,49 @@ PacketQueue::retry()
     sendDeferredPacket();
 }
 
+void
+PacketQueue::insertDeferred(size_t pos, const DeferredPacket &dp)
+{
+    assert(pos <= transmitSize);
+
+    if (transmitSize == transmitList.size()) {
+        // out of space, double the size of the ring and unwrap it
+        std::vector<DeferredPacket> grown(transmitList.size() * 2);
+        for (size_t i = 0; i < transmitSize; ++i)
+            grown[i] = deferredAt(i);
+        transmitList.swap(grown);
+        transmitHead = 0;
+    }
+
+    if (pos == 0) {
+        // move the head back rather than shifting the packets
+        transmitHead = (transmitHead - 1) & (transmitList.size() - 1);
+    } else {
+        // shift the younger packets one step towards the tail
+        for (size_t i = transmitSize; i > pos; --i)
+            deferredAt(i) = deferredAt(i - 1);
+    }
+    deferredAt(pos) = dp;
+    ++transmitSize;
+}
+
+PacketQueue::DeferredPacket
+PacketQueue::popDeferred()
+{
+    assert(transmitSize != 0);
+    DeferredPacket dp = deferredAt(0);
+    transmitHead = (transmitHead + 1) & (transmitList.size() - 1);
+    --transmitSize;
+    return dp;
+}
+
 bool
 PacketQueue::checkConflict(const PacketPtr pkt, const int blk_size) const
 {
     // caller is responsible for ensuring that all packets have the
     // same alignment
-    for (const auto& p : transmitList) {
-        if (p.pkt->matchBlockAddr(pkt, blk_size))
+    for (size_t i = 0; i < transmitSize; ++i) {
+        if (deferredAt(i).pkt->matchBlockAddr(pkt, blk_size))
             return true;
     }
     return false;
@@ -88,13 +125,13 @@ PacketQueue::trySatisfyFunctional(PacketPtr pkt)
 {
     pkt->pushLabel(label);
 
-    auto i = transmitList.begin();
+    size_t i = 0;
     bool found = false;
 
-    while (!found && i != transmitList.end()) {
+    while (!found && i < transmitSize) {
         // If the buffered packet contains data, and it overlaps the
         // current packet, then update data
-        found = pkt->trySatisfyFunctional(i->pkt);
+        found = pkt->trySatisfyFunctional(deferredAt(i).pkt);
         ++i;
     }
 
@@ -118,7 +155,7 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
 
     // add a very basic sanity check on the port to ensure the
     // invisible buffer is not growing beyond reasonable limits
-    if (!_disableSanityCheck && transmitList.size() > 128) {
+    if (!_disableSanityCheck && transmitSize > 128) {
         panic("Packet queue %s has grown beyond 128 packets\n",
               name());
     }
@@ -135,19 +172,19 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
     // order by tick; however, if forceOrder is set, also make sure
     // not to re-order in front of some existing packet with the same
     // address
-    auto it = transmitList.end();
-    while (it != transmitList.begin()) {
-        --it;
-        if ((forceOrder && it->pkt->matchAddr(pkt)) || it->tick <= when) {
-            // emplace inserts the element before the position pointed to by
-            // the iterator, so advance it one step
-            transmitList.emplace(++it, when, pkt);
+    size_t pos = transmitSize;
+    while (pos != 0) {
+        const DeferredPacket &p = deferredAt(pos - 1);
+        if ((forceOrder && p.pkt->matchAddr(pkt)) || p.tick <= when) {
+            // insert the packet right after this one
+            insertDeferred(pos, DeferredPacket(when, pkt));
             return;
         }
+        --pos;
     }
     // either the packet list is empty or this has to be inserted
     // before every other packet
-    transmitList.emplace_front(when, pkt);
+    insertDeferred(0, DeferredPacket(when, pkt));
     schedSendEvent(when);
 }
 
@@ -178,7 +215,7 @@ PacketQueue::schedSendEvent(Tick when)
         // we get a MaxTick when there is no more to send, so if we're
         // draining, we may be done at this point
         if (drainState() == DrainState::Draining &&
-            transmitList.empty() && !sendEvent.scheduled()) {
+            transmitSize == 0 && !sendEvent.scheduled()) {
 
             DPRINTF(Drain, "PacketQueue done draining,"
                     "processing drain event\n");
@@ -194,26 +231,43 @@ PacketQueue::sendDeferredPacket()
     assert(!waitingOnRetry);
     assert(deferredPacketReady());
 
-    DeferredPacket dp = transmitList.front();
-
-    // take the packet of the list before sending it, as sending of
-    // the packet in some cases causes a new packet to be enqueued
-    // (most notaly when responding to the timing CPU, leading to a
-    // new request hitting in the L1 icache, leading to a new
-    // response)
-    transmitList.pop_front();
+    // send all the packets that are ready in one go, rather than
+    // using one event per packet, and stop at the first one that is
+    // not accepted; only send as many packets as were ready on
+    // entry, as a zero-latency responder may otherwise keep
+    // enqueueing new packets for this tick and we never return
+    size_t ready = 0;
+    while (ready < transmitSize && deferredAt(ready).tick <= curTick())
+        ++ready;
+
+    do {
+        // take the packet of the list before sending it, as sending
+        // of the packet in some cases causes a new packet to be
+        // enqueued (most notaly when responding to the timing CPU,
+        // leading to a new request hitting in the L1 icache, leading
+        // to a new response)
+        DeferredPacket dp = popDeferred();
+
+        // use the appropriate implementation of sendTiming based on
+        // the type of queue
+        waitingOnRetry = !sendTiming(dp.pkt);
+
+        if (waitingOnRetry) {
+            // put the packet back at the front of the list
+            insertDeferred(0, dp);
+        }
+    } while (!waitingOnRetry && --ready != 0 && deferredPacketReady());
 
-    // use the appropriate implementation of sendTiming based on the
-    // type of queue
-    waitingOnRetry = !sendTiming(dp.pkt);
+    // a packet enqueued while sending may have scheduled the send
+    // event, but it is either sent already or covered below, which
+    // also picks up anything still ready for the next tick
+    if (sendEvent.scheduled())
+        em.deschedule(&sendEvent);
 
     // if we succeeded and are not waiting for a retry, schedule the
     // next send
     if (!waitingOnRetry) {
         schedSendEvent(deferredPacketReadyTime());
-    } else {
-        // put the packet back at the front of the list
-        transmitList.emplace_front(dp);
     }
 }
 
@@ -227,7 +281,7 @@ PacketQueue::processSendEvent()
 DrainState
 PacketQueue::drain()
 {
-    if (transmitList.empty()) {
+    if (transmitSize == 0) {
         return DrainState::Drained;
     } else {
         DPRINTF(Drain, "PacketQueue not drained\n");
@@ -49,7 +49,7 @@
  * for the flow control of the port.
  */
 
-#include <list>
+#include <vector>
 
 #include "mem/port.hh"
 #include "sim/drain.hh"
@@ -71,15 +71,53 @@ class PacketQueue : public Drainable
       public:
         Tick tick;      ///< The tick when the packet is ready to transmit
         PacketPtr pkt;  ///< Pointer to the packet to transmit
+        DeferredPacket()
+            : tick(0), pkt(nullptr)
+        {}
         DeferredPacket(Tick t, PacketPtr p)
             : tick(t), pkt(p)
         {}
     };
 
-    typedef std::list<DeferredPacket> DeferredPacketList;
+    /**
+     * The outgoing packets, ordered by the tick they are ready, kept
+     * in a ring buffer. The buffer only grows, and its size is a
+     * power of 2, so once it has reached the working size of the
+     * queue no more allocation takes place. Packets are mostly
+     * added at the back, or put back at the front after a failed
+     * send, which are both constant time.
+     */
+    std::vector<DeferredPacket> transmitList;
+
+    /** Position of the first packet in transmitList. */
+    size_t transmitHead;
+
+    /** Number of packets in transmitList. */
+    size_t transmitSize;
+
+    /** Get the i-th packet of the transmit list. */
+    DeferredPacket&
+    deferredAt(size_t i)
+    {
+        return transmitList[(transmitHead + i) & (transmitList.size() - 1)];
+    }
+
+    const DeferredPacket&
+    deferredAt(size_t i) const
+    {
+        return transmitList[(transmitHead + i) & (transmitList.size() - 1)];
+    }
+
+    /**
+     * Insert a packet in the transmit list, growing it if needed.
+     *
+     * @param pos Position to insert at, between 0 and the list size
+     * @param dp The packet to insert
+     */
+    void insertDeferred(size_t pos, const DeferredPacket &dp);
 
-    /** A list of outgoing packets. */
-    DeferredPacketList transmitList;
+    /** Remove and return the packet at the head of the transmit list. */
+    DeferredPacket popDeferred();
 
     /** The manager which is used for the event queue */
     EventManager& em;
@@ -114,15 +152,17 @@ class PacketQueue : public Drainable
 
     /** Check whether we have a packet ready to go on the transmit list. */
     bool deferredPacketReady() const
-    { return !transmitList.empty() && transmitList.front().tick <= curTick(); }
+    { return transmitSize != 0 && deferredAt(0).tick <= curTick(); }
 
     /**
      * Attempt to send a packet. Note that a subclass of the
      * PacketQueue can override this method and thus change the
      * behaviour (as done by the cache for the request queue). The
-     * default implementation sends the head of the transmit list. The
-     * caller must guarantee that the list is non-empty and that the
-     * head packet is scheduled for curTick() (or earlier).
+     * default implementation sends all the packets of the transmit
+     * list that are ready, from the head, until one of them is
+     * refused. The caller must guarantee that the list is non-empty
+     * and that the head packet is scheduled for curTick() (or
+     * earlier).
      */
     virtual void sendDeferredPacket();
 
@@ -164,13 +204,13 @@ class PacketQueue : public Drainable
     /**
      * Get the size of the queue.
      */
-    size_t size() const { return transmitList.size(); }
+    size_t size() const { return transmitSize; }
 
     /**
      * Get the next packet ready time.
      */
     Tick deferredPacketReadyTime() const
-    { return transmitList.empty() ? MaxTick : transmitList.front().tick; }
+    { return transmitSize == 0 ? MaxTick : deferredAt(0).tick; }
 
     /**
      * Check if a packet corresponding to the same address exists in the
@@ -44,10 +44,19 @@
 #include <unistd.h>
 #include <zlib.h>
 
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
 
 #include "base/intmath.hh"
@@ -76,14 +85,75 @@ namespace gem5
 namespace memory
 {
 
+namespace
+{
+
+/**
+ * Get the size of the default hugetlbfs pages of the host, as used by
+ * MAP_HUGETLB.
+ */
+uint64_t
+hostHugePageSize()
+{
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    while (meminfo >> key) {
+        if (key == "Hugepagesize:") {
+            uint64_t size_kib;
+            if (meminfo >> size_kib)
+                return size_kib * 1024;
+            break;
+        }
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return 2 * 1024 * 1024;
+}
+
+/**
+ * Ask the host to allocate a region on a NUMA node, or on the node of
+ * the calling thread if no node is given. The node is only preferred,
+ * so the allocation still succeeds when the node runs out of memory.
+ */
+void
+bindToNode(uint8_t *pmem, uint64_t size, const AddrRange &range,
+           int numa_node)
+{
+#if defined(__linux__)
+    unsigned cpu, node = numa_node;
+    if (numa_node < 0 && syscall(SYS_getcpu, &cpu, &node, nullptr)) {
+        warn("Could not get the NUMA node of the host thread: %s\n",
+             strerror(errno));
+        return;
+    }
+
+    // the kernel ignores the last bit of the mask, leave room for it
+    const unsigned bits = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> mask(node / bits + 2, 0);
+    mask[node / bits] |= 1UL << (node % bits);
+    if (syscall(SYS_mbind, pmem, size, MPOL_PREFERRED, mask.data(),
+                mask.size() * bits, 0)) {
+        warn("Could not place range %s on host NUMA node %d: %s\n",
+             range.to_string(), node, strerror(errno));
+    }
+#else
+    warn_once("Host NUMA placement is only supported on Linux\n");
+#endif
+}
+
+} // anonymous namespace
+
 PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               MmapHugePages huge_pages, bool numa_local,
+                               int numa_node, bool _prefault) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
-    pageSize(sysconf(_SC_PAGE_SIZE))
+    pageSize(sysconf(_SC_PAGE_SIZE)), hugePages(huge_pages),
+    hugePageSize(0), numaLocal(numa_local), numaNode(numa_node),
+    stopPrefault(false)
 {
     // Register cleanup callback if requested.
     if (auto_unlink_shared_backstore && !sharedBackstore.empty()) {
@@ -93,6 +163,27 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
     if (mmap_using_noreserve)
         warn("Not reserving swap space. May cause SIGSEGV on actual usage\n");
 
+    if (hugePages == MmapHugePages::hugetlb) {
+        // the shared backing store is not on hugetlbfs
+        if (sharedBackstore.empty()) {
+            hugePageSize = hostHugePageSize();
+        } else {
+            warn("Cannot use hugetlbfs pages for a shared backing store, "
+                 "using transparent huge pages instead\n");
+        }
+    }
+
+#if defined(MADV_POPULATE_WRITE)
+    if (_prefault && mmap_using_noreserve)
+        warn("Pre-faulting the backing store commits all of it\n");
+#else
+    if (_prefault) {
+        warn("Pre-faulting the backing store is not supported on this "
+             "host\n");
+        _prefault = false;
+    }
+#endif
+
     // add the memories from the system to the address map as
     // appropriate
     for (const auto& m : _memories) {
@@ -193,6 +284,44 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                            f->isConfReported(), f->isInAddrMap(),
                            f->isKvmMap());
     }
+
+    // fault in the backing store in the background, so that neither
+    // the creation of the system nor the simulation has to wait for it
+    if (_prefault)
+        prefaultThread = std::thread([this]() { prefaultBackingStore(); });
+}
+
+void
+PhysicalMemory::prefaultBackingStore()
+{
+#if defined(MADV_POPULATE_WRITE)
+    // work in chunks, so that we can stop early, e.g. when the backing
+    // store is about to be overwritten by a checkpoint anyway
+    const uint64_t chunk_size = roundUp(64 * 1024 * 1024,
+                                        std::max<uint64_t>(hugePageSize,
+                                                           pageSize));
+    for (const auto& s : backingStore) {
+        for (uint64_t offset = 0; offset < s.mapSize; offset += chunk_size) {
+            // the pages keep their content, so the simulation can
+            // access the backing store at the same time
+            if (stopPrefault ||
+                madvise(s.pmem + offset,
+                        std::min(chunk_size, s.mapSize - offset),
+                        MADV_POPULATE_WRITE)) {
+                return;
+            }
+        }
+    }
+#endif
+}
+
+void
+PhysicalMemory::stopPrefaulting()
+{
+    if (prefaultThread.joinable()) {
+        stopPrefault = true;
+        prefaultThread.join();
+    }
 }
 
 void
@@ -238,21 +367,57 @@ PhysicalMemory::createBackingStore(
         map_flags |= MAP_NORESERVE;
     }
 
-    uint8_t* pmem = (uint8_t*) mmap(NULL, range.size(),
-                                    PROT_READ | PROT_WRITE,
-                                    map_flags, shm_fd, map_offset);
+    uint64_t map_size = range.size();
+    uint8_t* pmem = (uint8_t*) MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    // the hugetlbfs pool is set aside by the host administrator, fall
+    // back to transparent huge pages if it is too small
+    if (hugePageSize) {
+        map_size = roundUp(range.size(), hugePageSize);
+        pmem = (uint8_t*) mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                               map_flags | MAP_HUGETLB, shm_fd, map_offset);
+        if (pmem == (uint8_t*) MAP_FAILED) {
+            warn("Could not get %d bytes of huge pages for range %s (%s), "
+                 "using transparent huge pages instead\n", map_size,
+                 range.to_string(), strerror(errno));
+            map_size = range.size();
+        }
+    }
+#endif
 
     if (pmem == (uint8_t*) MAP_FAILED) {
-        perror("mmap");
-        fatal("Could not mmap %d bytes for range %s!\n", range.size(),
-              range.to_string());
+        pmem = (uint8_t*) mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                               map_flags, shm_fd, map_offset);
+
+        if (pmem == (uint8_t*) MAP_FAILED) {
+            perror("mmap");
+            fatal("Could not mmap %d bytes for range %s!\n", range.size(),
+                  range.to_string());
+        }
+
+#if defined(MADV_HUGEPAGE)
+        if (hugePages != MmapHugePages::none &&
+            madvise(pmem, map_size, MADV_HUGEPAGE)) {
+            warn("Could not use transparent huge pages for range %s: %s\n",
+                 range.to_string(), strerror(errno));
+        }
+#else
+        if (hugePages != MmapHugePages::none)
+            warn_once("Huge pages are not supported on this host\n");
+#endif
     }
 
+    // the placement policy only applies to the pages faulted in after
+    // it is set, so bind before any page is touched
+    if (numaLocal)
+        bindToNode(pmem, map_size, range, numaNode);
+
     // remember this backing store so we can checkpoint it and unmap
     // it appropriately
     backingStore.emplace_back(range, pmem,
                               conf_table_reported, in_addr_map, kvm_map,
-                              shm_fd, map_offset);
+                              shm_fd, map_offset, map_size);
 
     // point the memories to their backing store
     for (const auto& m : _memories) {
@@ -264,9 +429,11 @@ PhysicalMemory::createBackingStore(
 
 PhysicalMemory::~PhysicalMemory()
 {
+    stopPrefaulting();
+
     // unmap the backing store
     for (auto& s : backingStore)
-        munmap((char*)s.pmem, s.range.size());
+        munmap((char*)s.pmem, s.mapSize);
 }
 
 bool
@@ -420,6 +587,9 @@ PhysicalMemory::unserialize(CheckpointIn &cp)
         m->second->addLockedAddr(LockedAddr(lal_addr[i], lal_cid[i]));
     }
 
+    // restoring the backing stores faults them in anyway
+    stopPrefaulting();
+
     // unserialize the backing stores
     unsigned int nbr_of_stores;
     UNSERIALIZE_SCALAR(nbr_of_stores);
@@ -38,12 +38,15 @@
 #ifndef __MEM_PHYSICAL_HH__
 #define __MEM_PHYSICAL_HH__
 
+#include <atomic>
 #include <cstdint>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base/addr_range.hh"
 #include "base/addr_range_map.hh"
+#include "enums/MmapHugePages.hh"
 #include "mem/packet.hh"
 #include "sim/serialize.hh"
 
@@ -71,10 +74,10 @@ class BackingStoreEntry
      */
     BackingStoreEntry(AddrRange range, uint8_t* pmem,
                       bool conf_table_reported, bool in_addr_map, bool kvm_map,
-                      int shm_fd=-1, off_t shm_offset=0)
+                      int shm_fd=-1, off_t shm_offset=0, uint64_t map_size=0)
         : range(range), pmem(pmem), confTableReported(conf_table_reported),
           inAddrMap(in_addr_map), kvmMap(kvm_map), shmFd(shm_fd),
-          shmOffset(shm_offset)
+          shmOffset(shm_offset), mapSize(map_size ? map_size : range.size())
         {}
 
     /**
@@ -115,6 +118,12 @@ class BackingStoreEntry
       * of this backing store in the share memory. Otherwise, the value is 0.
       */
      off_t shmOffset;
+
+     /**
+      * The size of the host mapping, which is rounded up to the huge page
+      * size when the backing store is on hugetlbfs.
+      */
+     uint64_t mapSize;
 };
 
 /**
@@ -158,6 +167,21 @@ class PhysicalMemory : public Serializable
 
     long pageSize;
 
+    // How to back the memory with huge pages of the host, and the size
+    // of the hugetlbfs pages
+    const MmapHugePages hugePages;
+    uint64_t hugePageSize;
+
+    // Place the backing store on a host NUMA node, either the given
+    // one, or the node of the thread creating the system if negative
+    const bool numaLocal;
+    const int numaNode;
+
+    // Fault in the backing store in the background after creating it,
+    // until done or stopped
+    std::thread prefaultThread;
+    std::atomic<bool> stopPrefault;
+
     // The physical memory used to provide the memory in the simulated
     // system
     std::vector<BackingStoreEntry> backingStore;
@@ -182,6 +206,18 @@ class PhysicalMemory : public Serializable
                             bool conf_table_reported,
                             bool in_addr_map, bool kvm_map);
 
+    /**
+     * Fault in all the backing stores, without changing their content.
+     * This runs in its own thread.
+     */
+    void prefaultBackingStore();
+
+    /**
+     * Stop pre-faulting the backing stores, and wait for the thread
+     * doing it to finish.
+     */
+    void stopPrefaulting();
+
   public:
 
     /**
@@ -191,7 +227,10 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   MmapHugePages huge_pages=MmapHugePages::none,
+                   bool numa_local=false, int numa_node=-1,
+                   bool _prefault=false);
 
     /**
      * Unmap all the backing store we have used.
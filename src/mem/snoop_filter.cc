@@ -42,9 +42,11 @@
 
 #include "mem/snoop_filter.hh"
 
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/SnoopFilter.hh"
+#include "params/BaseIndexingPolicy.hh"
 #include "sim/system.hh"
 
 namespace gem5
@@ -52,17 +54,140 @@ namespace gem5
 
 const int SnoopFilter::SNOOP_MASK_SIZE;
 
+SnoopFilter::SnoopFilter(const SnoopFilterParams &p)
+    : SimObject(p), reqLookupResult(cachedLocations.end()),
+      linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
+      maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
+      system(p.system), requestorId(p.system->getRequestorId(this)),
+      indexingPolicy(p.indexing_policy),
+      replacementPolicy(p.replacement_policy), stats(this)
+{
+    if (indexingPolicy) {
+        fatal_if(!replacementPolicy,
+                 "A bounded snoop filter needs a replacement policy\n");
+        const auto &ip = static_cast<const BaseIndexingPolicyParams &>(
+            indexingPolicy->params());
+        fatal_if(ip.size / ip.entry_size != p.entries,
+                 "%s: the indexing policy covers %d entries instead of %d, "
+                 "its size should be the number of entries with one byte "
+                 "entries\n", name(), ip.size / ip.entry_size, p.entries);
+        entries.resize(p.entries);
+        for (unsigned i = 0; i < entries.size(); i++) {
+            indexingPolicy->setEntry(&entries[i], i);
+            entries[i].replacementData =
+                replacementPolicy->instantiateEntry();
+        }
+    }
+}
+
 void
 SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
 {
     SnoopItem& sf_item = sf_it->second;
     if ((sf_item.requested | sf_item.holder).none()) {
+        if (sf_item.entry) {
+            sf_item.entry->invalidate();
+            replacementPolicy->invalidate(sf_item.entry->replacementData);
+        }
         cachedLocations.erase(sf_it);
         DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n",
                 __func__);
     }
 }
 
+void
+SnoopFilter::allocateEntry(Addr line_addr, SnoopItem& sf_item)
+{
+    // index the sets with the line number, the status bits are below it
+    const Addr line_num = line_addr >> floorLog2(linesize);
+    const auto &candidates = indexingPolicy->getPossibleEntries(line_num);
+
+    // lines with requests in flight cannot be evicted, the responses
+    // still need to find them
+    evictable.clear();
+    for (const auto &candidate : candidates) {
+        auto entry = static_cast<SnoopFilterEntry*>(candidate);
+        if (!entry->isValid() ||
+            cachedLocations.at(entry->lineAddr).requested.none()) {
+            evictable.push_back(candidate);
+        }
+    }
+    if (evictable.empty()) {
+        DPRINTF(SnoopFilter, "%s:   no evictable entry for %#x\n",
+                __func__, line_addr);
+        stats.overflows++;
+        return;
+    }
+
+    auto entry = static_cast<SnoopFilterEntry*>(
+        replacementPolicy->getVictim(evictable));
+    if (entry->isValid()) {
+        evictEntry(entry);
+    }
+    entry->insert(indexingPolicy->extractTag(line_num),
+                  line_addr & LineSecure);
+    entry->lineAddr = line_addr;
+    replacementPolicy->reset(entry->replacementData);
+    sf_item.entry = entry;
+}
+
+void
+SnoopFilter::evictEntry(SnoopFilterEntry *entry)
+{
+    auto sf_it = cachedLocations.find(entry->lineAddr);
+    assert(sf_it != cachedLocations.end());
+    SnoopItem& sf_item = sf_it->second;
+    assert(sf_item.requested.none());
+
+    DPRINTF(SnoopFilter, "%s: evicting %#x SF value %x.%x\n", __func__,
+            entry->lineAddr, sf_item.requested, sf_item.holder);
+    stats.evictions++;
+
+    // forget about the line before snooping, the caches above may
+    // react to the snoop with requests of their own
+    const Addr line_addr = entry->lineAddr;
+    const SnoopMask holders = sf_item.holder;
+    entry->invalidate();
+    entry->lineAddr = MaxAddr;
+    replacementPolicy->invalidate(entry->replacementData);
+    cachedLocations.erase(sf_it);
+
+    backInvalidate(line_addr, holders);
+}
+
+void
+SnoopFilter::backInvalidate(Addr line_addr, SnoopMask holders)
+{
+    if (holders.none())
+        return;
+
+    Request::Flags flags = Request::CLEAN | Request::INVALIDATE |
+        Request::DST_POC;
+    if (line_addr & LineSecure) {
+        flags.set(Request::SECURE);
+    }
+    RequestPtr req = std::make_shared<Request>(line_addr & ~Addr(LineSecure),
+                                               linesize, flags, requestorId);
+    Packet pkt(req, MemCmd::CleanInvalidReq);
+    const bool is_timing = system->isTimingMode();
+    if (is_timing) {
+        pkt.setExpressSnoop();
+    }
+
+    // the caches write back their dirty copy, if any, and do not
+    // respond to cache maintenance snoops
+    for (const auto& p : maskToPortList(holders)) {
+        DPRINTF(SnoopFilter, "%s: %s for %s\n", __func__, p->name(),
+                pkt.print());
+        if (is_timing) {
+            p->sendTimingSnoopReq(&pkt);
+        } else {
+            p->sendAtomicSnoop(&pkt);
+        }
+        stats.backInvalidations++;
+    }
+}
+
 std::pair<SnoopFilter::SnoopList, Cycles>
 SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
                            cpu_side_port)
@@ -87,12 +212,20 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
     if (!is_hit && !allocate)
         return snoopDown(lookupLatency);
 
-    // If no hit in snoop filter create a new element and update iterator
+    // A bounded filter may have back-invalidated the line while the
+    // eviction was on its way, there is no one left to snoop
+    if (!is_hit && indexingPolicy && cpkt->isEviction())
+        return snoopDown(lookupLatency);
+
+    // If no hit in snoop filter create a new element and update iterator,
+    // a bounded filter only finds it an entry once the request is accepted
     if (!is_hit) {
         reqLookupResult.it =
             cachedLocations.emplace(line_addr, SnoopItem()).first;
     }
     SnoopItem& sf_item = reqLookupResult.it->second;
+    if (is_hit && sf_item.entry)
+        replacementPolicy->touch(sf_item.entry->replacementData);
     SnoopMask interested = sf_item.holder | sf_item.requested;
 
     // Store unmodified value of snoop filter item in temp storage in
@@ -165,15 +298,23 @@ SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
         assert(reqLookupResult.it->first == \
                 (is_secure ? ((addr & ~(Addr(linesize - 1))) | LineSecure) : \
                  (addr & ~(Addr(linesize - 1)))));
+        SnoopItem& sf_item = reqLookupResult.it->second;
         if (will_retry) {
             SnoopItem retry_item = reqLookupResult.retryItem;
             // Undo any changes made in lookupRequest to the snoop filter
             // entry if the request will come again. retryItem holds
             // the previous value of the snoopfilter entry.
-            reqLookupResult.it->second = retry_item;
+            sf_item = retry_item;
 
             DPRINTF(SnoopFilter, "%s:   restored SF value %x.%x\n",
                     __func__,  retry_item.requested, retry_item.holder);
+        } else if (indexingPolicy && !sf_item.entry &&
+                   (sf_item.requested | sf_item.holder).any()) {
+            // the request is accepted, make room for the line now; this
+            // may evict and back-invalidate another line, so it must be
+            // the last use of the lookup result
+            allocateEntry(reqLookupResult.it->first, sf_item);
+            return;
         }
 
         eraseIfNullEntry(reqLookupResult.it);
@@ -194,7 +335,8 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     auto sf_it = cachedLocations.find(line_addr);
     bool is_hit = (sf_it != cachedLocations.end());
 
-    panic_if(!is_hit && (cachedLocations.size() >= maxEntryCount),
+    panic_if(!is_hit && !indexingPolicy &&
+             (cachedLocations.size() >= maxEntryCount),
              "snoop filter exceeded capacity of %d cache blocks\n",
              maxEntryCount);
 
@@ -405,7 +547,16 @@ SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
                "holder of the requested data."),
       ADD_STAT(hitMultiSnoops, statistics::units::Count::get(),
                "Number of snoops hitting in the snoop filter with multiple "
-               "(>1) holders of the requested data.")
+               "(>1) holders of the requested data."),
+      ADD_STAT(evictions, statistics::units::Count::get(),
+               "Number of lines evicted from a bounded snoop filter."),
+      ADD_STAT(backInvalidations, statistics::units::Count::get(),
+               "Number of back-invalidation snoops sent to the caches "
+               "above because of evictions."),
+      ADD_STAT(overflows, statistics::units::Count::get(),
+               "Number of accepted requests whose line is tracked outside "
+               "of the sets of a bounded snoop filter because no line of "
+               "the set could be evicted.")
 {}
 
 void
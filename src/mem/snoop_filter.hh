@@ -46,7 +46,11 @@
 #include <bitset>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/tags/indexing_policies/base.hh"
+#include "mem/cache/tags/tagged_entry.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "mem/qport.hh"
@@ -85,6 +89,18 @@ namespace gem5
  *     upper cache dropped a line, making the snoop filter pessimistic for now
  * (4) ordering: there is no single point of order in the system.  Instead,
  *     requesting MSHRs track order between local requests and remote snoops
+ *
+ * By default the filter is unbounded and only sanity checks its size
+ * against the configured maximum capacity. When it is given an indexing
+ * policy, it instead models a finite, set-associative filter: the lines
+ * are tracked in a fixed number of entries, and making room for a new
+ * line evicts another one, which is back-invalidated in all the caches
+ * above that hold it. Lines with requests in flight are never evicted,
+ * as their responses still need to find them; if no line of a set can be
+ * evicted the new line is tracked outside of the sets until a later
+ * accepted request for it finds room. Entries are only allocated, and
+ * other lines evicted, once a request is known to be accepted, so a
+ * request that is retried leaves the sets untouched.
  */
 class SnoopFilter : public SimObject
 {
@@ -95,13 +111,7 @@ class SnoopFilter : public SimObject
 
     typedef std::vector<QueuedResponsePort*> SnoopList;
 
-    SnoopFilter (const SnoopFilterParams &p) :
-        SimObject(p), reqLookupResult(cachedLocations.end()),
-        linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
-        maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
-        stats(this)
-    {
-    }
+    SnoopFilter (const SnoopFilterParams &p);
 
     /**
      * Init a new snoop filter and tell it about all the cpu_sideports
@@ -210,6 +220,17 @@ class SnoopFilter : public SimObject
      */
     typedef std::bitset<SNOOP_MASK_SIZE> SnoopMask;
 
+    /**
+     * Entry of a bounded filter, recording which line occupies a way of
+     * the set-associative structure.
+     */
+    class SnoopFilterEntry : public TaggedEntry
+    {
+      public:
+        /** The line address, as used to index cachedLocations. */
+        Addr lineAddr = MaxAddr;
+    };
+
     /**
     * Per cache line item tracking a bitmask of ResponsePorts who have an
     * outstanding request to this line (requested) or already share a
@@ -219,6 +240,8 @@ class SnoopFilter : public SimObject
     {
         SnoopMask requested;
         SnoopMask holder;
+        /** Entry of a bounded filter tracking the line, if any. */
+        SnoopFilterEntry *entry = nullptr;
     };
     /**
      * HashMap of SnoopItems indexed by line address
@@ -263,6 +286,32 @@ class SnoopFilter : public SimObject
      */
     void eraseIfNullEntry(SnoopFilterCache::iterator& sf_it);
 
+    /**
+     * Finds an entry of the bounded filter for a newly tracked line,
+     * evicting another line if needed.
+     *
+     * @param line_addr Line address, including the line status bits.
+     * @param sf_item The item of the new line.
+     */
+    void allocateEntry(Addr line_addr, SnoopItem& sf_item);
+
+    /**
+     * Evicts the line held by an entry of the bounded filter,
+     * back-invalidating it in all the caches above that hold it.
+     *
+     * @param entry The entry to evict.
+     */
+    void evictEntry(SnoopFilterEntry *entry);
+
+    /**
+     * Sends a clean and invalidate snoop for a line to the given ports,
+     * so that they write back any dirty copy and drop the line.
+     *
+     * @param line_addr Line address, including the line status bits.
+     * @param holders The ports to snoop.
+     */
+    void backInvalidate(Addr line_addr, SnoopMask holders);
+
     /** Simple hash set of cached addresses. */
     SnoopFilterCache cachedLocations;
 
@@ -308,6 +357,20 @@ class SnoopFilter : public SimObject
     /** Max capacity in terms of cache blocks tracked, for sanity checking */
     const unsigned maxEntryCount;
 
+    /** The system, to know the memory mode for back-invalidations. */
+    System *const system;
+    /** Requestor id of the back-invalidations. */
+    const RequestorID requestorId;
+
+    /** Indexing policy of a bounded filter, nullptr if unbounded. */
+    BaseIndexingPolicy *const indexingPolicy;
+    /** Replacement policy of a bounded filter. */
+    replacement_policy::Base *const replacementPolicy;
+    /** The entries of a bounded filter. */
+    std::vector<SnoopFilterEntry> entries;
+    /** Scratch list of the entries that can be evicted from a set. */
+    std::vector<ReplaceableEntry*> evictable;
+
     /**
      * Use the lower bits of the address to keep track of the line status
      */
@@ -329,6 +392,10 @@ class SnoopFilter : public SimObject
         statistics::Scalar totSnoops;
         statistics::Scalar hitSingleSnoops;
         statistics::Scalar hitMultiSnoops;
+
+        statistics::Scalar evictions;
+        statistics::Scalar backInvalidations;
+        statistics::Scalar overflows;
     } stats;
 };
 
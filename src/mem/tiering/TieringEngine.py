@@ -0,0 +1,69 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+from m5.objects.TieringPolicies import *
+
+
+# The tiering engine sits in front of the memory controller(s) of a
+# fast and a slow memory tier, counts the accesses to every page, and
+# swaps hot slow tier pages with cold fast tier pages as decided by its
+# policy, modelling the copy traffic of the migrations.
+class TieringEngine(SimObject):
+    type = "TieringEngine"
+    cxx_header = "mem/tiering/engine.hh"
+    cxx_class = "gem5::memory::TieringEngine"
+
+    cpu_side_port = ResponsePort(
+        "This port receives requests and sends responses"
+    )
+    mem_side_port = RequestPort(
+        "This port sends requests and receives responses"
+    )
+
+    system = Param.System(Parent.any, "System the engine belongs to")
+
+    fast_range = Param.AddrRange("Address range of the fast tier")
+    slow_range = Param.AddrRange("Address range of the slow tier")
+    page_size = Param.MemorySize("4KiB", "Migration granularity")
+
+    policy = Param.BaseTieringPolicy(
+        ThresholdTieringPolicy(), "Page promotion policy"
+    )
+    epoch = Param.Latency(
+        "1ms", "Period after which the access counts are reset"
+    )
+    max_pending_promotions = Param.Unsigned(
+        16, "Number of promotions that can wait for a migration"
+    )
+
+    migration_bandwidth = Param.MemoryBandwidth(
+        "4GiB/s", "Bandwidth of the copy traffic of each migration phase"
+    )
+    copy_size = Param.Unsigned(64, "Size of the copy packets in bytes")
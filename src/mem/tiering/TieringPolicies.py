@@ -0,0 +1,72 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.SimObject import SimObject
+
+
+class BaseTieringPolicy(SimObject):
+    type = "BaseTieringPolicy"
+    abstract = True
+    cxx_header = "mem/tiering/policies.hh"
+    cxx_class = "gem5::memory::tiering::Base"
+
+
+class ThresholdTieringPolicy(BaseTieringPolicy):
+    type = "ThresholdTieringPolicy"
+    cxx_header = "mem/tiering/policies.hh"
+    cxx_class = "gem5::memory::tiering::Threshold"
+
+    threshold = Param.Unsigned(
+        8, "Number of accesses in an epoch that promotes a page"
+    )
+
+
+class LRUEpochTieringPolicy(BaseTieringPolicy):
+    type = "LRUEpochTieringPolicy"
+    cxx_header = "mem/tiering/policies.hh"
+    cxx_class = "gem5::memory::tiering::LRUEpoch"
+
+    threshold = Param.Unsigned(
+        2, "Minimum number of accesses in an epoch to promote a page"
+    )
+    # The promotions of an epoch are queued together, so this should not
+    # exceed the max_pending_promotions of the engine, or the extra
+    # promotions are dropped
+    max_promotions = Param.Unsigned(
+        16, "Maximum number of pages promoted at the end of an epoch"
+    )
+
+
+class TPPTieringPolicy(BaseTieringPolicy):
+    type = "TPPTieringPolicy"
+    cxx_header = "mem/tiering/policies.hh"
+    cxx_class = "gem5::memory::tiering::TPP"
+
+    # Only the promotions the engine queues count against the limit
+    max_promotions = Param.Unsigned(
+        256, "Maximum number of pages promoted per epoch"
+    )
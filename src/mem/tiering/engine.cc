@@ -0,0 +1,637 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/tiering/engine.hh"
+
+#include <limits>
+#include <memory>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/Drain.hh"
+#include "debug/Tiering.hh"
+#include "mem/tiering/policies.hh"
+#include "sim/serialize.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+TieringEngine::TieringEngine(const Params &p)
+    : SimObject(p),
+      copyEvent([this]{ processCopyEvent(); }, name()),
+      epochEvent([this]{ processEpochEvent(); }, name()),
+      cpuSidePort(name() + ".cpu_side_port", *this),
+      memSidePort(name() + ".mem_side_port", *this),
+      policy(p.policy),
+      fastRange(p.fast_range), slowRange(p.slow_range),
+      pageSize(p.page_size),
+      // the sizes are checked below, only guard against a division by 0
+      numFastPages(pageSize ? fastRange.size() / pageSize : 0),
+      numPages(pageSize ? numFastPages + slowRange.size() / pageSize : 0),
+      copySize(p.copy_size),
+      copyInterval(copySize * p.migration_bandwidth),
+      copiesPerPage(copySize ? pageSize / copySize : 0),
+      epoch(p.epoch),
+      maxPendingPromotions(p.max_pending_promotions),
+      requestorId(p.system->getRequestorId(this)),
+      pages(numPages), mediaToPage(numPages),
+      lruPrev(numFastPages + 1), lruNext(numFastPages + 1),
+      pendingCopy(nullptr), memSideBlocked(false), retryReq(false),
+      stats(*this)
+{
+    fatal_if(fastRange.interleaved() || slowRange.interleaved(),
+             "%s: the tiers cannot be interleaved ranges.", name());
+    fatal_if(fastRange.intersects(slowRange),
+             "%s: the fast and slow tiers overlap.", name());
+    fatal_if(!isPowerOf2(pageSize), "%s: the page size must be a power "
+             "of 2.", name());
+    fatal_if(fastRange.start() % pageSize || fastRange.size() % pageSize ||
+             slowRange.start() % pageSize || slowRange.size() % pageSize,
+             "%s: the tiers must be aligned to the page size.", name());
+    fatal_if((fastRange.size() + slowRange.size()) / pageSize >=
+             InvalidPage, "%s: too many pages.", name());
+    fatal_if(numFastPages == 0 || numPages == numFastPages,
+             "%s: each tier needs at least one page.", name());
+    fatal_if(copySize == 0 || pageSize % copySize,
+             "%s: the copy size must divide the page size.", name());
+    fatal_if(epoch == 0, "%s: the epoch cannot be 0.", name());
+
+    for (uint32_t page = 0; page < numPages; ++page) {
+        pages[page].media = page;
+        mediaToPage[page] = page;
+    }
+    resetLRU();
+}
+
+Port &
+TieringEngine::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side_port") {
+        return memSidePort;
+    } else if (if_name == "cpu_side_port") {
+        return cpuSidePort;
+    } else {
+        return SimObject::getPort(if_name, idx);
+    }
+}
+
+void
+TieringEngine::init()
+{
+    fatal_if(!cpuSidePort.isConnected() || !memSidePort.isConnected(),
+             "%s: the tiering engine is not connected on both sides.",
+             name());
+    cpuSidePort.sendRangeChange();
+}
+
+void
+TieringEngine::startup()
+{
+    schedule(epochEvent, curTick() + epoch);
+}
+
+uint32_t
+TieringEngine::pageOf(Addr addr) const
+{
+    if (fastRange.contains(addr))
+        return (addr - fastRange.start()) / pageSize;
+    if (slowRange.contains(addr))
+        return numFastPages + (addr - slowRange.start()) / pageSize;
+    return InvalidPage;
+}
+
+Addr
+TieringEngine::mediaAddr(uint32_t media, Addr offset) const
+{
+    if (media < numFastPages)
+        return fastRange.start() + Addr(media) * pageSize + offset;
+    return slowRange.start() + Addr(media - numFastPages) * pageSize +
+        offset;
+}
+
+Addr
+TieringEngine::remapAddr(Addr addr) const
+{
+    uint32_t page = pageOf(addr);
+    if (page == InvalidPage)
+        return addr;
+    return mediaAddr(pages[page].media, addr & (pageSize - 1));
+}
+
+void
+TieringEngine::recvFunctional(PacketPtr pkt)
+{
+    // the held requests are younger than what the memory holds, and
+    // the ones waiting for a replay are the youngest
+    pkt->pushLabel(name());
+    for (auto it = replayQueue.rbegin(); it != replayQueue.rend(); ++it) {
+        if (pkt->trySatisfyFunctional(*it)) {
+            pkt->popLabel();
+            return;
+        }
+    }
+    for (auto it = heldPackets.rbegin(); it != heldPackets.rend(); ++it) {
+        if (pkt->trySatisfyFunctional(*it)) {
+            pkt->popLabel();
+            return;
+        }
+    }
+    pkt->popLabel();
+
+    Addr orig_addr = pkt->getAddr();
+    panic_if(pageOf(orig_addr) != pageOf(orig_addr + pkt->getSize() - 1),
+             "%s: functional access %s crosses a page boundary.", name(),
+             pkt->print());
+    pkt->setAddr(remapAddr(orig_addr));
+    memSidePort.sendFunctional(pkt);
+    pkt->setAddr(orig_addr);
+}
+
+Tick
+TieringEngine::recvAtomic(PacketPtr pkt)
+{
+    Addr orig_addr = pkt->getAddr();
+    panic_if(pageOf(orig_addr) != pageOf(orig_addr + pkt->getSize() - 1),
+             "%s: atomic access %s crosses a page boundary.", name(),
+             pkt->print());
+    pkt->setAddr(remapAddr(orig_addr));
+    Tick latency = memSidePort.sendAtomic(pkt);
+    pkt->setAddr(orig_addr);
+    return latency;
+}
+
+bool
+TieringEngine::recvTimingReq(PacketPtr pkt)
+{
+    uint32_t page = pageOf(pkt->getAddr());
+    panic_if(page != pageOf(pkt->getAddr() + pkt->getSize() - 1),
+             "%s: request %s crosses a page boundary.", name(),
+             pkt->print());
+
+    // keep the requests in order behind the replayed ones
+    bool held = page != InvalidPage && isMigrating(page);
+    if (!replayQueue.empty() || !sendOrHold(pkt)) {
+        retryReq = true;
+        return false;
+    }
+
+    if (held) {
+        DPRINTF(Tiering, "Holding %s during the migration of page %u\n",
+                pkt->print(), page);
+        ++stats.heldRequests;
+    }
+    if (page != InvalidPage)
+        recordAccess(page);
+    return true;
+}
+
+bool
+TieringEngine::sendOrHold(PacketPtr pkt)
+{
+    Addr orig_addr = pkt->getAddr();
+    uint32_t page = pageOf(orig_addr);
+    if (page != InvalidPage && isMigrating(page)) {
+        heldPackets.push_back(pkt);
+        return true;
+    }
+
+    if (memSideBlocked)
+        return false;
+
+    bool expects_response = pkt->needsResponse() && !pkt->cacheResponding();
+    if (expects_response)
+        pkt->pushSenderState(new EngineSenderState(orig_addr));
+    pkt->setAddr(remapAddr(orig_addr));
+
+    if (!memSidePort.sendTimingReq(pkt)) {
+        pkt->setAddr(orig_addr);
+        if (expects_response)
+            delete pkt->popSenderState();
+        memSideBlocked = true;
+        return false;
+    }
+
+    // a migration only commits once the requests to its pages are done
+    if (expects_response && page != InvalidPage)
+        ++pages[page].inFlight;
+    return true;
+}
+
+bool
+TieringEngine::recvTimingResp(PacketPtr pkt)
+{
+    if (pkt->req->requestorId() == requestorId) {
+        assert(mig.active);
+        delete pkt;
+        if (++mig.done == 2 * copiesPerPage) {
+            if (mig.committed)
+                endMigration();
+            else
+                commitMigration();
+        }
+        return true;
+    }
+
+    auto *state = dynamic_cast<EngineSenderState *>(pkt->senderState);
+    panic_if(!state, "%s: got a response without sender state.", name());
+
+    Addr remapped_addr = pkt->getAddr();
+    pkt->senderState = state->predecessor;
+    pkt->setAddr(state->origAddr);
+
+    if (!cpuSidePort.sendTimingResp(pkt)) {
+        // let the packet look like we did not touch it
+        pkt->senderState = state;
+        pkt->setAddr(remapped_addr);
+        return false;
+    }
+
+    uint32_t page = pageOf(state->origAddr);
+    delete state;
+    if (page != InvalidPage) {
+        assert(pages[page].inFlight);
+        --pages[page].inFlight;
+        if (isMigrating(page))
+            commitMigration();
+    }
+    return true;
+}
+
+void
+TieringEngine::recvReqRetry()
+{
+    assert(memSideBlocked);
+    memSideBlocked = false;
+
+    // the copy traffic goes first
+    if (pendingCopy) {
+        PacketPtr pkt = pendingCopy;
+        pendingCopy = nullptr;
+        sendCopy(pkt);
+        if (pendingCopy)
+            return;
+        if (mig.issued < 2 * copiesPerPage && !copyEvent.scheduled())
+            schedule(copyEvent, curTick() + copyInterval);
+    }
+
+    sendReplays();
+}
+
+void
+TieringEngine::recordAccess(uint32_t page)
+{
+    Page &p = pages[page];
+    if (p.accesses == 0)
+        touchedPages.push_back(page);
+    if (p.accesses < std::numeric_limits<uint32_t>::max())
+        ++p.accesses;
+    p.lastAccess = curTick();
+
+    if (p.media < numFastPages) {
+        ++stats.fastAccesses;
+        touchLRU(p.media);
+        return;
+    }
+
+    ++stats.slowAccesses;
+    if (!p.queued && !isMigrating(page) &&
+        policy->promoteOnAccess({page, p.accesses, p.lastAccess}) &&
+        queuePromotion(page)) {
+        policy->promotionQueued({page, p.accesses, p.lastAccess});
+    }
+}
+
+bool
+TieringEngine::queuePromotion(uint32_t page)
+{
+    if (pendingPromotions.size() >= maxPendingPromotions) {
+        DPRINTF(Tiering, "Dropping the promotion of page %u\n", page);
+        ++stats.promotionsDropped;
+        return false;
+    }
+
+    pages[page].queued = true;
+    pendingPromotions.push_back(page);
+    ++stats.promotionsQueued;
+    startMigration();
+    return true;
+}
+
+void
+TieringEngine::startMigration()
+{
+    if (mig.active || pendingPromotions.empty() ||
+        drainState() == DrainState::Draining) {
+        return;
+    }
+
+    uint32_t page = pendingPromotions.front();
+    pendingPromotions.pop_front();
+    pages[page].queued = false;
+    assert(pages[page].media >= numFastPages);
+
+    mig = Migration();
+    mig.active = true;
+    mig.hot = page;
+    mig.slowMedia = pages[page].media;
+    mig.fastMedia = lruPrev[numFastPages];
+    mig.cold = mediaToPage[mig.fastMedia];
+    mig.start = curTick();
+
+    DPRINTF(Tiering, "Promoting page %u, demoting page %u\n", mig.hot,
+            mig.cold);
+    schedule(copyEvent, curTick());
+}
+
+void
+TieringEngine::processCopyEvent()
+{
+    assert(mig.active && mig.issued < 2 * copiesPerPage);
+
+    // the copy reads both pages before the swap, and the copy writes
+    // both pages after it
+    unsigned idx = mig.issued++;
+    uint32_t media = idx < copiesPerPage ? mig.fastMedia : mig.slowMedia;
+    Addr addr = mediaAddr(media, Addr(idx % copiesPerPage) * copySize);
+    RequestPtr req = std::make_shared<Request>(addr, copySize, 0,
+                                               requestorId);
+    PacketPtr pkt = new Packet(req, mig.committed ? MemCmd::WriteReq :
+                                                    MemCmd::ReadReq);
+    pkt->allocate();
+    sendCopy(pkt);
+
+    if (!pendingCopy && mig.issued < 2 * copiesPerPage)
+        schedule(copyEvent, curTick() + copyInterval);
+}
+
+void
+TieringEngine::sendCopy(PacketPtr pkt)
+{
+    if (pkt->isWrite()) {
+        // the data moved when the swap was committed, pick it up right
+        // before the write reaches the memory so that it includes any
+        // functional write since
+        RequestPtr req = std::make_shared<Request>(
+            pkt->getAddr(), pkt->getSize(), 0, requestorId);
+        Packet data(req, MemCmd::ReadReq);
+        data.dataStatic(pkt->getPtr<uint8_t>());
+        memSidePort.sendFunctional(&data);
+    }
+
+    if (memSideBlocked || !memSidePort.sendTimingReq(pkt)) {
+        pendingCopy = pkt;
+        memSideBlocked = true;
+        return;
+    }
+
+    if (pkt->isWrite())
+        stats.copyWriteBytes += pkt->getSize();
+    else
+        stats.copyReadBytes += pkt->getSize();
+}
+
+void
+TieringEngine::commitMigration()
+{
+    if (!mig.active || mig.committed || mig.done < 2 * copiesPerPage ||
+        pages[mig.hot].inFlight || pages[mig.cold].inFlight) {
+        return;
+    }
+
+    // swap the data, one copy packet worth at a time so that pages
+    // interleaved across several memories are handled
+    std::vector<uint8_t> fast_data(copySize), slow_data(copySize);
+    auto access = [this](Addr addr, uint8_t *data, MemCmd cmd) {
+        RequestPtr req = std::make_shared<Request>(addr, copySize, 0,
+                                                   requestorId);
+        Packet pkt(req, cmd);
+        pkt.dataStatic(data);
+        memSidePort.sendFunctional(&pkt);
+    };
+    for (Addr offset = 0; offset < pageSize; offset += copySize) {
+        Addr fast_addr = mediaAddr(mig.fastMedia, offset);
+        Addr slow_addr = mediaAddr(mig.slowMedia, offset);
+        access(fast_addr, fast_data.data(), MemCmd::ReadReq);
+        access(slow_addr, slow_data.data(), MemCmd::ReadReq);
+        access(fast_addr, slow_data.data(), MemCmd::WriteReq);
+        access(slow_addr, fast_data.data(), MemCmd::WriteReq);
+    }
+
+    pages[mig.hot].media = mig.fastMedia;
+    pages[mig.cold].media = mig.slowMedia;
+    mediaToPage[mig.fastMedia] = mig.hot;
+    mediaToPage[mig.slowMedia] = mig.cold;
+    touchLRU(mig.fastMedia);
+
+    DPRINTF(Tiering, "Swapped pages %u and %u\n", mig.hot, mig.cold);
+    mig.committed = true;
+    mig.issued = 0;
+    mig.done = 0;
+    schedule(copyEvent, curTick());
+}
+
+void
+TieringEngine::endMigration()
+{
+    DPRINTF(Tiering, "Migration of page %u done, replaying %d requests\n",
+            mig.hot, heldPackets.size());
+    ++stats.migrations;
+    stats.totMigrationLatency += curTick() - mig.start;
+    mig.active = false;
+
+    replayQueue.insert(replayQueue.end(), heldPackets.begin(),
+                       heldPackets.end());
+    heldPackets.clear();
+    sendReplays();
+    startMigration();
+}
+
+void
+TieringEngine::sendReplays()
+{
+    while (!replayQueue.empty()) {
+        if (!sendOrHold(replayQueue.front()))
+            break;
+        replayQueue.pop_front();
+    }
+
+    if (replayQueue.empty() && retryReq && !memSideBlocked) {
+        retryReq = false;
+        cpuSidePort.sendRetryReq();
+    }
+    checkDrained();
+}
+
+void
+TieringEngine::processEpochEvent()
+{
+    std::vector<tiering::PageInfo> candidates;
+    for (uint32_t page : touchedPages) {
+        const Page &p = pages[page];
+        if (p.media >= numFastPages && !p.queued && !isMigrating(page))
+            candidates.push_back({page, p.accesses, p.lastAccess});
+    }
+
+    std::vector<uint64_t> promote;
+    policy->endEpoch(candidates, promote);
+
+    for (uint64_t page : promote) {
+        panic_if(page >= numPages, "%s: invalid page %llu to promote.",
+                 name(), page);
+        const Page &p = pages[page];
+        if (p.media >= numFastPages && !p.queued && !isMigrating(page) &&
+            queuePromotion(page)) {
+            policy->promotionQueued({page, p.accesses, p.lastAccess});
+        }
+    }
+
+    // the counts of this epoch are only reset once the policy saw them
+    for (uint32_t page : touchedPages)
+        pages[page].accesses = 0;
+    touchedPages.clear();
+
+    ++stats.epochs;
+    schedule(epochEvent, curTick() + epoch);
+}
+
+void
+TieringEngine::touchLRU(uint32_t media)
+{
+    const uint32_t head = numFastPages;
+    lruNext[lruPrev[media]] = lruNext[media];
+    lruPrev[lruNext[media]] = lruPrev[media];
+    lruNext[media] = lruNext[head];
+    lruPrev[media] = head;
+    lruPrev[lruNext[head]] = media;
+    lruNext[head] = media;
+}
+
+void
+TieringEngine::resetLRU()
+{
+    const uint32_t size = numFastPages + 1;
+    for (uint32_t i = 0; i < size; ++i) {
+        lruNext[i] = (i + 1) % size;
+        lruPrev[i] = (i + size - 1) % size;
+    }
+}
+
+void
+TieringEngine::checkDrained()
+{
+    if (drainState() == DrainState::Draining && !mig.active &&
+        heldPackets.empty() && replayQueue.empty() && !pendingCopy) {
+        DPRINTF(Drain, "Tiering engine done draining\n");
+        signalDrainDone();
+    }
+}
+
+DrainState
+TieringEngine::drain()
+{
+    // pending promotions are kept, but not started until resumed
+    if (mig.active || !heldPackets.empty() || !replayQueue.empty() ||
+        pendingCopy) {
+        return DrainState::Draining;
+    }
+    return DrainState::Drained;
+}
+
+void
+TieringEngine::drainResume()
+{
+    startMigration();
+}
+
+void
+TieringEngine::serialize(CheckpointOut &cp) const
+{
+    assert(!mig.active);
+    std::vector<uint32_t> mapping(numPages);
+    for (uint32_t page = 0; page < numPages; ++page)
+        mapping[page] = pages[page].media;
+    SERIALIZE_CONTAINER(mapping);
+}
+
+void
+TieringEngine::unserialize(CheckpointIn &cp)
+{
+    std::vector<uint32_t> mapping;
+    UNSERIALIZE_CONTAINER(mapping);
+    fatal_if(mapping.size() != numPages, "%s: the checkpoint has %d "
+             "pages, expected %d.", name(), mapping.size(), numPages);
+
+    for (uint32_t page = 0; page < numPages; ++page) {
+        fatal_if(mapping[page] >= numPages, "%s: invalid media page in "
+                 "the checkpoint.", name());
+        pages[page].media = mapping[page];
+        mediaToPage[mapping[page]] = page;
+    }
+    resetLRU();
+}
+
+TieringEngine::TieringStats::TieringStats(TieringEngine &engine)
+    : statistics::Group(&engine),
+      ADD_STAT(fastAccesses, statistics::units::Count::get(),
+               "Number of requests to pages of the fast tier"),
+      ADD_STAT(slowAccesses, statistics::units::Count::get(),
+               "Number of requests to pages of the slow tier"),
+      ADD_STAT(fastAccessRatio, statistics::units::Ratio::get(),
+               "Fraction of the requests to pages of the fast tier",
+               fastAccesses / (fastAccesses + slowAccesses)),
+      ADD_STAT(promotionsQueued, statistics::units::Count::get(),
+               "Number of pages queued for promotion"),
+      ADD_STAT(promotionsDropped, statistics::units::Count::get(),
+               "Number of promotions dropped as the queue was full"),
+      ADD_STAT(migrations, statistics::units::Count::get(),
+               "Number of page swaps completed"),
+      ADD_STAT(copyReadBytes, statistics::units::Byte::get(),
+               "Number of bytes read by the migrations"),
+      ADD_STAT(copyWriteBytes, statistics::units::Byte::get(),
+               "Number of bytes written by the migrations"),
+      ADD_STAT(heldRequests, statistics::units::Count::get(),
+               "Number of requests held during a migration"),
+      ADD_STAT(totMigrationLatency, statistics::units::Tick::get(),
+               "Total time spent migrating pages"),
+      ADD_STAT(avgMigrationLatency, statistics::units::Rate<
+                    statistics::units::Tick, statistics::units::Count>::get(),
+               "Average time taken by a page swap",
+               totMigrationLatency / migrations),
+      ADD_STAT(epochs, statistics::units::Count::get(),
+               "Number of epochs elapsed")
+{
+    avgMigrationLatency.precision(2);
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a memory tiering engine that migrates pages between a
+ * fast and a slow memory tier.
+ */
+
+#ifndef __MEM_TIERING_ENGINE_HH__
+#define __MEM_TIERING_ENGINE_HH__
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "base/addr_range.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/packet.hh"
+#include "mem/port.hh"
+#include "mem/request.hh"
+#include "params/TieringEngine.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+namespace tiering
+{
+class Base;
+} // namespace tiering
+
+/**
+ * The tiering engine sits in front of the memory controller(s) of a
+ * fast and a slow memory tier, e.g. the DRAM and NVM ranges of a
+ * HeteroMemCtrl, or local and CXL attached memory behind a crossbar.
+ * It keeps a page remapping table between the addresses seen by the
+ * cpu side and the media addresses, counts the accesses to every page,
+ * and lets a policy decide which slow tier pages to promote.
+ *
+ * A promotion swaps the promoted page with the least recently used
+ * page of the fast tier. The swap is modelled as timed copy traffic,
+ * issued at the migration bandwidth: the engine first reads both pages,
+ * then commits the swap in the remapping table and writes both pages
+ * back to their new location. Accesses to the two pages are held in
+ * the engine for the duration of the migration, and replayed with the
+ * new mapping once the copy completes.
+ *
+ * The data itself is moved functionally when the swap is committed,
+ * once the copy reads and all the requests in flight to the two pages
+ * have completed. This relies on the memory behind the engine updating
+ * its backing store when it accepts a write, as the memory controllers
+ * do, so the engine must not be separated from them by a buffering
+ * component such as a bridge. Migrations only happen in timing mode,
+ * atomic and functional accesses are only remapped.
+ */
+class TieringEngine : public SimObject
+{
+  public:
+    using Params = TieringEngineParams;
+    TieringEngine(const Params &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+    void startup() override;
+
+    DrainState drain() override;
+    void drainResume() override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+  protected:
+    class EngineResponsePort : public ResponsePort
+    {
+      public:
+        EngineResponsePort(const std::string &_name, TieringEngine &_engine)
+            : ResponsePort(_name), engine(_engine)
+        {}
+
+      protected:
+        void
+        recvFunctional(PacketPtr pkt) override
+        {
+            engine.recvFunctional(pkt);
+        }
+
+        Tick
+        recvAtomic(PacketPtr pkt) override
+        {
+            return engine.recvAtomic(pkt);
+        }
+
+        bool
+        recvTimingReq(PacketPtr pkt) override
+        {
+            return engine.recvTimingReq(pkt);
+        }
+
+        void
+        recvRespRetry() override
+        {
+            engine.memSidePort.sendRetryResp();
+        }
+
+        AddrRangeList
+        getAddrRanges() const override
+        {
+            return engine.memSidePort.getAddrRanges();
+        }
+
+      private:
+        TieringEngine &engine;
+    };
+
+    class EngineRequestPort : public RequestPort
+    {
+      public:
+        EngineRequestPort(const std::string &_name, TieringEngine &_engine)
+            : RequestPort(_name), engine(_engine)
+        {}
+
+      protected:
+        bool
+        recvTimingResp(PacketPtr pkt) override
+        {
+            return engine.recvTimingResp(pkt);
+        }
+
+        void
+        recvReqRetry() override
+        {
+            engine.recvReqRetry();
+        }
+
+        void
+        recvRangeChange() override
+        {
+            engine.cpuSidePort.sendRangeChange();
+        }
+
+      private:
+        TieringEngine &engine;
+    };
+
+    /**
+     * Sender state remembering the address a packet had on the cpu
+     * side, restored on the response.
+     */
+    class EngineSenderState : public Packet::SenderState
+    {
+      public:
+        EngineSenderState(Addr _origAddr) : origAddr(_origAddr) {}
+
+        /** The address before remapping. */
+        const Addr origAddr;
+    };
+
+    /** Page number of the addresses outside of both tiers. */
+    static constexpr uint32_t InvalidPage = ~uint32_t(0);
+
+    /** Remapping and access information of a page. */
+    struct Page
+    {
+        /** Media page currently holding the page. */
+        uint32_t media = 0;
+        /** Number of accesses in the current epoch. */
+        uint32_t accesses = 0;
+        /** Tick of the last access. */
+        Tick lastAccess = 0;
+        /** Number of requests in flight that expect a response. */
+        uint16_t inFlight = 0;
+        /** Whether the page is waiting to be promoted. */
+        bool queued = false;
+    };
+
+    /** State of the migration in progress, if any. */
+    struct Migration
+    {
+        bool active = false;
+        /** Whether the data and the mapping have been swapped. */
+        bool committed = false;
+        /** Page being promoted. */
+        uint32_t hot = 0;
+        /** Page being demoted to make room for it. */
+        uint32_t cold = 0;
+        /** Fast and slow media pages being swapped. */
+        uint32_t fastMedia = 0;
+        uint32_t slowMedia = 0;
+        /** Progress of the copy, for the current phase. */
+        unsigned issued = 0;
+        unsigned done = 0;
+        Tick start = 0;
+    };
+
+    void recvFunctional(PacketPtr pkt);
+    Tick recvAtomic(PacketPtr pkt);
+    bool recvTimingReq(PacketPtr pkt);
+    bool recvTimingResp(PacketPtr pkt);
+    void recvReqRetry();
+
+    /** Page of an address seen by the cpu side, or InvalidPage. */
+    uint32_t pageOf(Addr addr) const;
+
+    /** Address on the mem side of an address seen by the cpu side. */
+    Addr remapAddr(Addr addr) const;
+
+    /** Address of an offset within a media page. */
+    Addr mediaAddr(uint32_t media, Addr offset) const;
+
+    /** Whether a page is one of the two pages being swapped. */
+    bool
+    isMigrating(uint32_t page) const
+    {
+        return mig.active && (page == mig.hot || page == mig.cold);
+    }
+
+    /**
+     * Remaps a packet and sends it to the memory side, or holds it if
+     * its page is migrating.
+     *
+     * @return false if the memory side refused the packet
+     */
+    bool sendOrHold(PacketPtr pkt);
+
+    /** Updates the access information of a page and the policy. */
+    void recordAccess(uint32_t page);
+
+    /**
+     * Queues a page for promotion, and starts it if possible.
+     *
+     * @return false if the promotion was dropped as too many are pending
+     */
+    bool queuePromotion(uint32_t page);
+
+    void startMigration();
+    void commitMigration();
+    void endMigration();
+
+    /** Issues the next copy packet of the migration in progress. */
+    void processCopyEvent();
+    EventFunctionWrapper copyEvent;
+
+    /** Sends a copy packet, refreshing the data of copy writes. */
+    void sendCopy(PacketPtr pkt);
+
+    /** Replays the requests that were held during a migration. */
+    void sendReplays();
+
+    void processEpochEvent();
+    EventFunctionWrapper epochEvent;
+
+    /** Moves a fast tier media page to the head of the LRU list. */
+    void touchLRU(uint32_t media);
+
+    /** Resets the LRU list of the fast tier to media page order. */
+    void resetLRU();
+
+    /** Signals the end of the drain if the engine is idle. */
+    void checkDrained();
+
+    EngineResponsePort cpuSidePort;
+    EngineRequestPort memSidePort;
+
+    tiering::Base *const policy;
+
+    const AddrRange fastRange;
+    const AddrRange slowRange;
+    const Addr pageSize;
+    const uint32_t numFastPages;
+    const uint32_t numPages;
+
+    /** Size of the copy packets and interval between them. */
+    const unsigned copySize;
+    const Tick copyInterval;
+
+    /** Number of copy packets per page. */
+    const unsigned copiesPerPage;
+
+    const Tick epoch;
+    const unsigned maxPendingPromotions;
+
+    /** Requestor id of the copy traffic. */
+    const RequestorID requestorId;
+
+    /** Pages in the cpu side order. */
+    std::vector<Page> pages;
+
+    /** Page held by every media page. */
+    std::vector<uint32_t> mediaToPage;
+
+    /**
+     * Doubly linked LRU list of the fast tier media pages, stored as
+     * indices, with a sentinel at index numFastPages.
+     */
+    std::vector<uint32_t> lruPrev;
+    std::vector<uint32_t> lruNext;
+
+    /** Pages accessed in the current epoch. */
+    std::vector<uint32_t> touchedPages;
+
+    /** Pages waiting to be promoted, oldest first. */
+    std::deque<uint32_t> pendingPromotions;
+
+    Migration mig;
+
+    /** Copy packet refused by the memory side. */
+    PacketPtr pendingCopy;
+
+    /** Requests to the migrating pages, in arrival order. */
+    std::deque<PacketPtr> heldPackets;
+
+    /** Held requests waiting to be replayed. */
+    std::deque<PacketPtr> replayQueue;
+
+    /** Whether the memory side refused a packet and owes a retry. */
+    bool memSideBlocked;
+
+    /** Whether a retry must be sent to the cpu side. */
+    bool retryReq;
+
+    struct TieringStats : public statistics::Group
+    {
+        TieringStats(TieringEngine &engine);
+
+        /** Accesses served by the fast and the slow tier. */
+        statistics::Scalar fastAccesses;
+        statistics::Scalar slowAccesses;
+        statistics::Formula fastAccessRatio;
+        /** Promotions queued, dropped and completed. */
+        statistics::Scalar promotionsQueued;
+        statistics::Scalar promotionsDropped;
+        statistics::Scalar migrations;
+        /** Bytes of copy traffic. */
+        statistics::Scalar copyReadBytes;
+        statistics::Scalar copyWriteBytes;
+        /** Requests held because their page was migrating. */
+        statistics::Scalar heldRequests;
+        /** Time taken by the migrations. */
+        statistics::Scalar totMigrationLatency;
+        statistics::Formula avgMigrationLatency;
+        statistics::Scalar epochs;
+    } stats;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_TIERING_ENGINE_HH__
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/tiering/policies.hh"
+
+#include <algorithm>
+
+#include "params/BaseTieringPolicy.hh"
+#include "params/LRUEpochTieringPolicy.hh"
+#include "params/TPPTieringPolicy.hh"
+#include "params/ThresholdTieringPolicy.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+namespace tiering
+{
+
+Base::Base(const Params &p)
+    : SimObject(p)
+{
+}
+
+Threshold::Threshold(const Params &p)
+    : Base(p), threshold(p.threshold)
+{
+    fatal_if(threshold == 0, "%s: the threshold must be at least 1.",
+             name());
+}
+
+bool
+Threshold::promoteOnAccess(const PageInfo &info)
+{
+    // only trigger once per epoch, when the threshold is crossed
+    return info.accesses == threshold;
+}
+
+LRUEpoch::LRUEpoch(const Params &p)
+    : Base(p), threshold(p.threshold), maxPromotions(p.max_promotions)
+{
+}
+
+void
+LRUEpoch::endEpoch(std::vector<PageInfo> &candidates,
+                   std::vector<uint64_t> &promote)
+{
+    // hottest first, and most recently used first among equally hot
+    // pages
+    auto hotter = [](const PageInfo &a, const PageInfo &b) {
+        return a.accesses != b.accesses ? a.accesses > b.accesses :
+                                          a.lastAccess > b.lastAccess;
+    };
+    size_t num = std::min<size_t>(maxPromotions, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + num,
+                      candidates.end(), hotter);
+
+    for (size_t i = 0; i < num && candidates[i].accesses >= threshold;
+         ++i) {
+        promote.push_back(candidates[i].page);
+    }
+}
+
+TPP::TPP(const Params &p)
+    : Base(p), maxPromotions(p.max_promotions), promotions(0)
+{
+}
+
+bool
+TPP::promoteOnAccess(const PageInfo &info)
+{
+    return info.accesses == 2 && promotions < maxPromotions;
+}
+
+void
+TPP::promotionQueued(const PageInfo &info)
+{
+    // only charge the rate limit for the promotions that will happen
+    ++promotions;
+}
+
+void
+TPP::endEpoch(std::vector<PageInfo> &candidates,
+              std::vector<uint64_t> &promote)
+{
+    promotions = 0;
+}
+
+} // namespace tiering
+} // namespace memory
+} // namespace gem5
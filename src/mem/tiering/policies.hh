@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Page promotion policies of the memory tiering engine.
+ */
+
+#ifndef __MEM_TIERING_POLICIES_HH__
+#define __MEM_TIERING_POLICIES_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+struct BaseTieringPolicyParams;
+struct ThresholdTieringPolicyParams;
+struct LRUEpochTieringPolicyParams;
+struct TPPTieringPolicyParams;
+
+namespace memory
+{
+
+namespace tiering
+{
+
+/** Access information of a page, as seen by the policies. */
+struct PageInfo
+{
+    /** Page number, in the address space seen by the cpu side. */
+    uint64_t page;
+    /** Number of accesses to the page in the current epoch. */
+    unsigned accesses;
+    /** Tick of the last access to the page. */
+    Tick lastAccess;
+};
+
+/**
+ * Base class of the page promotion policies. The engine consults the
+ * policy on every access to a page of the slow tier, which allows
+ * promoting pages on the critical path, and at the end of every epoch
+ * with all the slow tier pages accessed during the epoch, which allows
+ * promoting pages in batches. Demotions are implicit: a promoted page
+ * swaps places with the least recently used page of the fast tier.
+ */
+class Base : public SimObject
+{
+  public:
+    using Params = BaseTieringPolicyParams;
+    Base(const Params &p);
+
+    /**
+     * Called on every access to a page of the slow tier.
+     *
+     * @param info Access information of the page, including this access
+     * @return Whether the page should be promoted right away
+     */
+    virtual bool
+    promoteOnAccess(const PageInfo &info)
+    {
+        return false;
+    }
+
+    /**
+     * Called when a page the policy asked to promote is queued for
+     * promotion. The engine drops the promotions it has no room for,
+     * and the policy is not told about those.
+     *
+     * @param info Access information of the page
+     */
+    virtual void
+    promotionQueued(const PageInfo &info)
+    {
+    }
+
+    /**
+     * Called at the end of every epoch, before the access counts are
+     * reset.
+     *
+     * @param candidates Slow tier pages accessed during the epoch, that
+     * the policy is free to reorder
+     * @param promote Filled with the pages to promote, in order
+     */
+    virtual void
+    endEpoch(std::vector<PageInfo> &candidates,
+             std::vector<uint64_t> &promote)
+    {
+    }
+};
+
+/**
+ * Promotes a page as soon as its number of accesses within the epoch
+ * reaches a threshold.
+ */
+class Threshold : public Base
+{
+  public:
+    using Params = ThresholdTieringPolicyParams;
+    Threshold(const Params &p);
+
+    bool promoteOnAccess(const PageInfo &info) override;
+
+  protected:
+    /** Number of accesses in an epoch that triggers a promotion. */
+    const unsigned threshold;
+};
+
+/**
+ * Promotes, at the end of every epoch, the hottest slow tier pages of
+ * the epoch, similar to what a kernel scanning the accessed bits of the
+ * page tables once per epoch would do.
+ */
+class LRUEpoch : public Base
+{
+  public:
+    using Params = LRUEpochTieringPolicyParams;
+    LRUEpoch(const Params &p);
+
+    void endEpoch(std::vector<PageInfo> &candidates,
+                  std::vector<uint64_t> &promote) override;
+
+  protected:
+    /** Minimum number of accesses in the epoch for a page to move. */
+    const unsigned threshold;
+
+    /** Maximum number of pages promoted per epoch. */
+    const unsigned maxPromotions;
+};
+
+/**
+ * Mimics the transparent page placement of Linux: a slow tier page is
+ * promoted on its second access within the epoch, i.e. when a hinting
+ * fault finds it was accessed recently, and the number of promotions
+ * per epoch is rate limited.
+ */
+class TPP : public Base
+{
+  public:
+    using Params = TPPTieringPolicyParams;
+    TPP(const Params &p);
+
+    bool promoteOnAccess(const PageInfo &info) override;
+
+    void promotionQueued(const PageInfo &info) override;
+
+    void endEpoch(std::vector<PageInfo> &candidates,
+                  std::vector<uint64_t> &promote) override;
+
+  protected:
+    /** Maximum number of pages promoted per epoch. */
+    const unsigned maxPromotions;
+
+    /** Number of pages queued for promotion in the current epoch. */
+    unsigned promotions;
+};
+
+} // namespace tiering
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_TIERING_POLICIES_HH__
@@ -45,6 +45,7 @@
 
 #include "mem/xbar.hh"
 
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/AddrRanges.hh"
@@ -61,9 +62,13 @@ BaseXBar::BaseXBar(const BaseXBarParams &p)
       responseLatency(p.response_latency),
       headerLatency(p.header_latency),
       width(p.width),
+      routeCache(p.route_cache_size),
       gotAddrRanges(p.port_default_connection_count +
                           p.port_mem_side_ports_connection_count, false),
       gotAllAddrRanges(false), defaultPortID(InvalidPortID),
+      numPorts(p.port_cpu_side_ports_connection_count +
+               p.port_mem_side_ports_connection_count +
+               p.port_default_connection_count),
       useDefaultRange(p.use_default_range),
 
       ADD_STAT(transDist, statistics::units::Count::get(),
@@ -73,6 +78,10 @@ BaseXBar::BaseXBar(const BaseXBarParams &p)
       ADD_STAT(pktSize, statistics::units::Byte::get(),
                "Cumulative packet size per connected requestor and responder")
 {
+    fatal_if(!routeCache.empty() && !isPowerOf2(routeCache.size()),
+             "%s: the route cache size must be a power of 2\n", name());
+
+    flushRouteCache();
 }
 
 BaseXBar::~BaseXBar()
@@ -144,6 +153,7 @@ BaseXBar::Layer<SrcType, DstType>::Layer(DstType& _port, BaseXBar& _xbar,
                                        const std::string& _name) :
     statistics::Group(&_xbar, _name.c_str()),
     port(_port), xbar(_xbar), _name(xbar.name() + "." + _name), state(IDLE),
+    waitingForLayer(xbar.numPorts), waitingHead(0), numWaiting(0),
     waitingForPeer(NULL), releaseEvent([this]{ releaseLayer(); }, name()),
     ADD_STAT(occupancy, statistics::units::Tick::get(), "Layer occupancy (ticks)"),
     ADD_STAT(utilization, statistics::units::Ratio::get(), "Layer utilization")
@@ -158,6 +168,52 @@ BaseXBar::Layer<SrcType, DstType>::Layer(DstType& _port, BaseXBar& _xbar,
     utilization = occupancy / simTicks;
 }
 
+template <typename SrcType, typename DstType>
+bool
+BaseXBar::Layer<SrcType, DstType>::isWaiting(const SrcType* src_port) const
+{
+    for (size_t i = 0; i < numWaiting; ++i) {
+        if (waitingForLayer[(waitingHead + i) % waitingForLayer.size()] ==
+            src_port)
+            return true;
+    }
+    return false;
+}
+
+template <typename SrcType, typename DstType>
+void
+BaseXBar::Layer<SrcType, DstType>::pushWaiting(SrcType* src_port)
+{
+    panic_if(numWaiting == waitingForLayer.size(),
+             "%s: more ports waiting than connected\n", name());
+    waitingForLayer[(waitingHead + numWaiting) % waitingForLayer.size()] =
+        src_port;
+    ++numWaiting;
+}
+
+template <typename SrcType, typename DstType>
+void
+BaseXBar::Layer<SrcType, DstType>::pushWaitingFront(SrcType* src_port)
+{
+    panic_if(numWaiting == waitingForLayer.size(),
+             "%s: more ports waiting than connected\n", name());
+    waitingHead = (waitingHead + waitingForLayer.size() - 1) %
+        waitingForLayer.size();
+    waitingForLayer[waitingHead] = src_port;
+    ++numWaiting;
+}
+
+template <typename SrcType, typename DstType>
+SrcType*
+BaseXBar::Layer<SrcType, DstType>::popWaiting()
+{
+    assert(numWaiting != 0);
+    SrcType* src_port = waitingForLayer[waitingHead];
+    waitingHead = (waitingHead + 1) % waitingForLayer.size();
+    --numWaiting;
+    return src_port;
+}
+
 template <typename SrcType, typename DstType>
 void BaseXBar::Layer<SrcType, DstType>::occupyLayer(Tick until)
 {
@@ -193,14 +249,13 @@ BaseXBar::Layer<SrcType, DstType>::tryTiming(SrcType* src_port)
     // for a retry from the peer
     if (state == BUSY || waitingForPeer != NULL) {
         // the port should not be waiting already
-        assert(std::find(waitingForLayer.begin(), waitingForLayer.end(),
-                         src_port) == waitingForLayer.end());
+        assert(!isWaiting(src_port));
 
         // put the port at the end of the retry list waiting for the
         // layer to be freed up (and in the case of a busy peer, for
         // that transaction to go through, and then the layer to free
         // up)
-        waitingForLayer.push_back(src_port);
+        pushWaiting(src_port);
         return false;
     }
 
@@ -255,7 +310,7 @@ BaseXBar::Layer<SrcType, DstType>::releaseLayer()
     state = IDLE;
 
     // bus layer is now idle, so if someone is waiting we can retry
-    if (!waitingForLayer.empty()) {
+    if (numWaiting != 0) {
         // there is no point in sending a retry if someone is still
         // waiting for the peer
         if (waitingForPeer == NULL)
@@ -272,7 +327,7 @@ void
 BaseXBar::Layer<SrcType, DstType>::retryWaiting()
 {
     // this should never be called with no one waiting
-    assert(!waitingForLayer.empty());
+    assert(numWaiting != 0);
 
     // we always go to retrying from idle
     assert(state == IDLE);
@@ -282,8 +337,7 @@ BaseXBar::Layer<SrcType, DstType>::retryWaiting()
 
     // set the retrying port to the front of the retry list and pop it
     // off the list
-    SrcType* retryingPort = waitingForLayer.front();
-    waitingForLayer.pop_front();
+    SrcType* retryingPort = popWaiting();
 
     // tell the port to retry, which in some cases ends up calling the
     // layer again
@@ -313,7 +367,7 @@ BaseXBar::Layer<SrcType, DstType>::recvRetry()
     // add the port where the failed packet originated to the front of
     // the waiting ports for the layer, this allows us to call retry
     // on the port immediately if the crossbar layer is idle
-    waitingForLayer.push_front(waitingForPeer);
+    pushWaitingFront(waitingForPeer);
 
     // we are no longer waiting for the peer
     waitingForPeer = NULL;
@@ -334,9 +388,30 @@ BaseXBar::findPort(AddrRange addr_range)
     // ranges of all connected CPU-side-port modules
     assert(gotAllAddrRanges);
 
+    // Check the route cache, which only covers lookups within a
+    // single block
+    const Addr block = addr_range.start() >> routeCacheBlockBits;
+    RouteCacheEntry *entry = nullptr;
+    if (!routeCache.empty() && !addr_range.interleaved() &&
+        addr_range.size() != 0 &&
+        ((addr_range.end() - 1) >> routeCacheBlockBits) == block) {
+        entry = &routeCache[block & (routeCache.size() - 1)];
+        if (entry->block == block) {
+            return entry->port;
+        }
+    }
+
     // Check the address map interval tree
     auto i = portMap.contains(addr_range);
     if (i != portMap.end()) {
+        // only remember the route if all of the block goes to the
+        // same port
+        if (entry && AddrRange(block << routeCacheBlockBits,
+                               (block + 1) << routeCacheBlockBits).
+            isSubset(i->first)) {
+            entry->block = block;
+            entry->port = i->second;
+        }
         return i->second;
     }
 
@@ -359,6 +434,15 @@ BaseXBar::findPort(AddrRange addr_range)
           name());
 }
 
+void
+BaseXBar::flushRouteCache()
+{
+    for (auto &entry : routeCache) {
+        entry.block = MaxAddr;
+        entry.port = InvalidPortID;
+    }
+}
+
 /** Function called by the port when the crossbar is receiving a range change.*/
 void
 BaseXBar::recvRangeChange(PortID mem_side_port_id)
@@ -383,6 +467,9 @@ BaseXBar::recvRangeChange(PortID mem_side_port_id)
             DPRINTF(AddrRanges, "Got address ranges from all responders\n");
     }
 
+    // the address map is about to change, so forget all routes
+    flushRouteCache();
+
     // note that we could get the range from the default port at any
     // point in time, and we cannot assume that the default range is
     // set before the other ones are, so we do additional checks once
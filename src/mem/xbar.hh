@@ -46,10 +46,10 @@
 #ifndef __MEM_XBAR_HH__
 #define __MEM_XBAR_HH__
 
-#include <deque>
-#include <unordered_map>
+#include <vector>
 
 #include "base/addr_range_map.hh"
+#include "base/cast.hh"
 #include "base/types.hh"
 #include "mem/qport.hh"
 #include "params/BaseXBar.hh"
@@ -205,10 +205,34 @@ class BaseXBar : public ClockedObject
         State state;
 
         /**
-         * A deque of ports that retry should be called on because
-         * the original send was delayed due to a busy layer.
+         * The ports that retry should be called on because the
+         * original send was delayed due to a busy layer. As a port
+         * waits at most once per layer, this is a ring buffer sized
+         * to the number of ports of the crossbar, and queuing a port
+         * never allocates.
          */
-        std::deque<SrcType*> waitingForLayer;
+        std::vector<SrcType*> waitingForLayer;
+
+        /** Index of the oldest waiting port in waitingForLayer. */
+        size_t waitingHead;
+
+        /** Number of ports in waitingForLayer. */
+        size_t numWaiting;
+
+        /** Check if a port is already waiting for the layer. */
+        bool isWaiting(const SrcType* src_port) const;
+
+        /** Add a port to the back of the waiting ports. */
+        void pushWaiting(SrcType* src_port);
+
+        /**
+         * Add a port to the front of the waiting ports, so that it is
+         * the next one to be retried.
+         */
+        void pushWaitingFront(SrcType* src_port);
+
+        /** Remove and return the port at the front of the waiting ports. */
+        SrcType* popWaiting();
 
         /**
          * Track who is waiting for the retry when receiving it from a
@@ -319,12 +343,77 @@ class BaseXBar : public ClockedObject
     AddrRangeMap<PortID, 3> portMap;
 
     /**
-     * Remember where request packets came from so that we can route
-     * responses to the appropriate port. This relies on the fact that
-     * the underlying Request pointer inside the Packet stays
-     * constant.
+     * An entry of the route cache, mapping a block of the address
+     * space to the port that all of the block is routed to.
+     */
+    struct RouteCacheEntry
+    {
+        /** Block number, MaxAddr if the entry is invalid. */
+        Addr block;
+        PortID port;
+    };
+
+    /**
+     * Log2 of the size of the blocks tracked by the route cache. The
+     * cache only serves lookups that fall within a single block.
+     */
+    static const unsigned routeCacheBlockBits = 6;
+
+    /**
+     * Direct-mapped cache in front of the address decoding, holding
+     * the destination port of recently seen blocks. It is flushed
+     * whenever the address map changes.
+     */
+    std::vector<RouteCacheEntry> routeCache;
+
+    /** Invalidate all the entries of the route cache. */
+    void flushRouteCache();
+
+    /**
+     * Sender state used to route a response back to the CPU-side port
+     * the request came from. It is pushed on requests that expect a
+     * response when they are forwarded, and popped once the response
+     * comes back through the crossbar, which saves looking up the
+     * route in a table for every response.
+     */
+    class RouteState : public Packet::SenderState
+    {
+      public:
+        /** The CPU-side port the response is routed to. */
+        const PortID port;
+
+        RouteState(PortID _port) : port(_port) {}
+    };
+
+    /**
+     * Remember where a request came from by pushing a RouteState on
+     * it, before forwarding it.
+     *
+     * @param pkt Request packet about to be forwarded
+     * @param cpu_side_port_id Port the request was received on
      */
-    std::unordered_map<RequestPtr, PortID> routeTo;
+    void
+    pushRoute(PacketPtr pkt, PortID cpu_side_port_id)
+    {
+        pkt->pushSenderState(new RouteState(cpu_side_port_id));
+    }
+
+    /**
+     * Get the port a response should be routed to, leaving the route
+     * on the packet.
+     */
+    PortID
+    peekRoute(PacketPtr pkt) const
+    {
+        return safe_cast<RouteState*>(pkt->senderState)->port;
+    }
+
+    /** Remove the route from a packet. */
+    void
+    popRoute(PacketPtr pkt)
+    {
+        delete safe_cast<RouteState*>(pkt->popSenderState());
+    }
 
     /** all contigous ranges seen by this crossbar */
     AddrRangeList xbarRanges;
@@ -382,6 +471,12 @@ class BaseXBar : public ClockedObject
     /** Port that handles requests that don't match any of the interfaces.*/
     PortID defaultPortID;
 
+    /**
+     * Total number of ports of the crossbar, which bounds the number of
+     * ports that can wait for a layer.
+     */
+    const size_t numPorts;
+
     /** If true, use address range provided by default device.  Any
        address not handled by another port and not in default device's
        range will cause a fatal error.  If false, just send all
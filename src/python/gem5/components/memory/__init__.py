@@ -37,6 +37,10 @@ from .multi_channel import DualChannelDDR3_2133
 from .multi_channel import DualChannelDDR4_2400
 from .multi_channel import DualChannelLPDDR3_1600
 from .hbm import HBM2Stack
+from .cxl import CXLExpanderDDR4_2400
+from .cxl import CXLExpanderDDR5_4400
+from .cxl import CXLType3Memory
+from .cxl import CXLExpandedMemory
 
 try:
     from .dramsys import DRAMSysMem
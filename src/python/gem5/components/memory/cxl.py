@@ -0,0 +1,216 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+""" CXL.mem Type-3 memory expanders
+"""
+
+from ...utils.override import overrides
+from m5.util.convert import toMemorySize
+from ..boards.abstract_board import AbstractBoard
+from .abstract_memory_system import AbstractMemorySystem
+from .dram_interfaces.ddr4 import DDR4_2400_8x8
+from .dram_interfaces.ddr5 import DDR5_4400_4x8
+from m5.objects import AddrRange, CXLLink, DRAMInterface, MemCtrl, Port
+from typing import List, Optional, Sequence, Tuple, Type
+
+
+class CXLType3Memory(AbstractMemorySystem):
+    """A CXL Type-3 memory device, i.e. host-managed device memory made
+    of a DRAM channel behind a CXL.mem link.
+
+    The device memory is a single address range that is only reachable
+    through the link, so it can be exposed to the software as a
+    separate NUMA range, see CXLExpandedMemory.
+    """
+
+    def __init__(
+        self,
+        dram_interface_class: Type[DRAMInterface],
+        size: Optional[str] = None,
+        num_lanes: int = 16,
+        link_speed: int = 32,
+        port_latency: str = "25ns",
+        flit_size: int = 68,
+        slots_per_flit: int = 4,
+        credits: int = 32,
+    ) -> None:
+        """
+        :param dram_interface_class: The DRAM interface type of the device
+        :param size: Optionally specify the size of the device memory. By
+            default, it is the size of the DRAM device specified
+        :param num_lanes: The number of lanes of the link
+        :param link_speed: The speed of each lane, in Gb/s
+        :param port_latency: The latency of each of the CXL ports at the
+            ends of the link
+        :param flit_size: The size of a flit in bytes, 68 for CXL 1.1 and
+            2.0, or 256 for CXL 3.0
+        :param slots_per_flit: The number of 16B slots in a flit
+        :param credits: The number of link layer credits in each direction
+        """
+        super().__init__()
+
+        self.mem_ctrl = MemCtrl(dram=dram_interface_class())
+        self.link = CXLLink(
+            num_lanes=num_lanes,
+            link_speed=link_speed,
+            port_latency=port_latency,
+            flit_size=flit_size,
+            slots_per_flit=slots_per_flit,
+            req_credits=credits,
+            resp_credits=credits,
+        )
+        self.link.mem_side_port = self.mem_ctrl.port
+
+        if size:
+            self._size = toMemorySize(size)
+        else:
+            self._size = (
+                dram_interface_class.device_size.value
+                * dram_interface_class.devices_per_rank.value
+                * dram_interface_class.ranks_per_channel.value
+            )
+
+    @overrides(AbstractMemorySystem)
+    def incorporate_memory(self, board: AbstractBoard) -> None:
+        pass
+
+    @overrides(AbstractMemorySystem)
+    def get_mem_ports(self) -> Sequence[Tuple[AddrRange, Port]]:
+        return [(self.mem_ctrl.dram.range, self.link.cpu_side_port)]
+
+    @overrides(AbstractMemorySystem)
+    def get_memory_controllers(self) -> List[MemCtrl]:
+        return [self.mem_ctrl]
+
+    @overrides(AbstractMemorySystem)
+    def get_size(self) -> int:
+        return self._size
+
+    @overrides(AbstractMemorySystem)
+    def set_memory_range(self, ranges: List[AddrRange]) -> None:
+        if len(ranges) != 1 or ranges[0].size() != self._size:
+            raise Exception(
+                "CXL Type-3 memory requires a single range which matches "
+                "the memory's size.\n"
+                f"The range size: {ranges[0].size()}\n"
+                f"This memory's size: {self._size}"
+            )
+        self.mem_ctrl.dram.range = ranges[0]
+        self.link.ranges = ranges
+
+
+class CXLExpandedMemory(AbstractMemorySystem):
+    """A memory system made of a local memory, directly attached to the
+    board, and a CXL Type-3 memory expander.
+
+    The board sees a single memory system. The local memory is placed
+    at the start of the memory ranges of the board and the expander
+    right after it, so that the expander memory is a separate range,
+    and the two can be used as two NUMA ranges.
+    """
+
+    def __init__(
+        self,
+        local_memory: AbstractMemorySystem,
+        cxl_memory: CXLType3Memory,
+    ) -> None:
+        """
+        :param local_memory: The memory directly attached to the board
+        :param cxl_memory: The CXL memory expander
+        """
+        super().__init__()
+        self.local_memory = local_memory
+        self.cxl_memory = cxl_memory
+
+    @overrides(AbstractMemorySystem)
+    def incorporate_memory(self, board: AbstractBoard) -> None:
+        self.local_memory.incorporate_memory(board)
+        self.cxl_memory.incorporate_memory(board)
+
+    @overrides(AbstractMemorySystem)
+    def get_mem_ports(self) -> Sequence[Tuple[AddrRange, Port]]:
+        return list(self.local_memory.get_mem_ports()) + list(
+            self.cxl_memory.get_mem_ports()
+        )
+
+    @overrides(AbstractMemorySystem)
+    def get_memory_controllers(self) -> List[MemCtrl]:
+        return (
+            self.local_memory.get_memory_controllers()
+            + self.cxl_memory.get_memory_controllers()
+        )
+
+    @overrides(AbstractMemorySystem)
+    def get_size(self) -> int:
+        return self.local_memory.get_size() + self.cxl_memory.get_size()
+
+    @overrides(AbstractMemorySystem)
+    def set_memory_range(self, ranges: List[AddrRange]) -> None:
+        if sum(r.size() for r in ranges) != self.get_size():
+            raise Exception(
+                "The memory ranges do not match the size of the local and "
+                "the CXL memory.\n"
+                f"The ranges size: {sum(r.size() for r in ranges)}\n"
+                f"This memory's size: {self.get_size()}"
+            )
+
+        # carve the local memory, and then the CXL memory, out of the
+        # ranges in order, each of them has to fit in a single range
+        ranges = list(ranges)
+        for memory in [self.local_memory, self.cxl_memory]:
+            size = memory.get_size()
+            if ranges[0].size() < size:
+                raise Exception(
+                    "Each of the local and the CXL memory has to fit in a "
+                    "single memory range of the board."
+                )
+            start = int(ranges[0].start)
+            memory.set_memory_range([AddrRange(start=start, size=size)])
+            if ranges[0].size() == size:
+                ranges.pop(0)
+            else:
+                ranges[0] = AddrRange(
+                    start=start + size, size=ranges[0].size() - size
+                )
+
+    @overrides(AbstractMemorySystem)
+    def _post_instantiate(self) -> None:
+        self.local_memory._post_instantiate()
+        self.cxl_memory._post_instantiate()
+
+
+def CXLExpanderDDR4_2400(size: Optional[str] = None) -> CXLType3Memory:
+    """
+    A CXL Type-3 memory expander using a DDR4_2400_8x8 based channel
+    """
+    return CXLType3Memory(DDR4_2400_8x8, size=size)
+
+
+def CXLExpanderDDR5_4400(size: Optional[str] = None) -> CXLType3Memory:
+    """
+    A CXL Type-3 memory expander using a DDR5_4400_4x8 based channel
+    """
+    return CXLType3Memory(DDR5_4400_4x8, size=size)
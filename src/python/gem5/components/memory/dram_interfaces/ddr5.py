@@ -102,6 +102,12 @@ class DDR5_4400_4x8(DRAMInterface):
     # tRFC (Normal) for 16Gb device is 295ns
     tRFC = "295ns"
 
+    # tRFCsb for 16Gb device is 130ns, same-bank refresh is only allowed
+    # in fine granularity refresh mode, where all the banks are refreshed
+    # every tREFI2 (1.95us) when selecting refresh_mode = "same_bank"
+    tRFCsb = "130ns"
+    tREFIsb = "1.95us"
+
     tPPD = "0.908ns"  # 2nCK
     tWR = "30ns"
 
@@ -141,6 +141,8 @@ class LPDDR5_5500_1x16_BG_BL32(DRAMInterface):
     # LPDDR5, 8 Gbit/channel for 280ns tRFCab
     tRFC = "210ns"
     tREFI = "3.9us"
+    # tRFCpb for per-bank refresh, refresh_mode = "per_bank"
+    tRFCsb = "120ns"
 
     # Greater of 4 CK or 6.25 ns
     tWTR = "6.25ns"
@@ -81,7 +81,8 @@ def DIMM_DDR5_4400(
     size: Optional[str] = None,
 ) -> AbstractMemorySystem:
     """
-    A single DIMM of DDR5 has two channels
+    A single DIMM of DDR5 has two channels, each 32-bit sub-channel has
+    its own independent controller
     """
     return ChanneledMemory(DDR5_4400_4x8, 2, 64, size=size)
 
@@ -90,7 +91,8 @@ def DIMM_DDR5_6400(
     size: Optional[str] = None,
 ) -> AbstractMemorySystem:
     """
-    A single DIMM of DDR5 has two channels
+    A single DIMM of DDR5 has two channels, each 32-bit sub-channel has
+    its own independent controller
     """
     return ChanneledMemory(DDR5_6400_4x8, 2, 64, size=size)
 
@@ -99,6 +101,7 @@ def DIMM_DDR5_8400(
     size: Optional[str] = None,
 ) -> AbstractMemorySystem:
     """
-    A single DIMM of DDR5 has two channels
+    A single DIMM of DDR5 has two channels, each 32-bit sub-channel has
+    its own independent controller
     """
     return ChanneledMemory(DDR5_8400_4x8, 2, 64, size=size)
@@ -50,6 +50,13 @@ class MemoryMode(Enum):
     vals = ["invalid", "atomic", "timing", "atomic_noncaching"]
 
 
+# How the backing store asks the host for huge pages: not at all,
+# through transparent huge pages (madvise), or from the preallocated
+# hugetlbfs pool (MAP_HUGETLB), falling back to transparent huge pages
+class MmapHugePages(ScopedEnum):
+    vals = ["none", "transparent", "hugetlb"]
+
+
 class System(SimObject):
     type = "System"
     cxx_header = "sim/system.hh"
@@ -80,6 +87,31 @@ class System(SimObject):
         False, "mmap the backing store without reserving swap"
     )
 
+    # Large guest memories accessed randomly cause many host TLB
+    # misses, which huge pages reduce. On multi-socket hosts, the
+    # backing store can also be placed on a host NUMA node. The backing
+    # store is created with the system, before any simulation thread
+    # exists, so by default it goes on the node of the thread creating
+    # the system; with several event queues, give the node of the host
+    # cores they are expected to run on. All the stores of a system go
+    # on the same node. Pre-faulting happens in a background thread, so
+    # that the simulation pays for fewer page faults without waiting
+    # for the whole backing store to be faulted in up front.
+    mmap_huge_pages = Param.MmapHugePages(
+        "none", "Back the memory with huge pages of the host"
+    )
+    mmap_numa_local = Param.Bool(
+        False, "Place the backing store on a single host NUMA node"
+    )
+    mmap_numa_node = Param.Int(
+        -1,
+        "Host NUMA node for mmap_numa_local, or -1 for the node of the "
+        "thread that creates the system",
+    )
+    mmap_prefault = Param.Bool(
+        False, "Fault in the backing store in the background"
+    )
+
     # The memory ranges are to be populated when creating the system
     # such that these can be passed from the I/O subsystem through an
     # I/O bridge or cache
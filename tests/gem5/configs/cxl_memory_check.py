@@ -0,0 +1,102 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+This script checks that a CXLExpandedMemory can be built on a board: the
+local memory and the CXL memory expander get consecutive ranges, and
+traffic to the expander range crosses the CXL link.
+"""
+
+import m5
+
+import argparse
+
+from m5.objects import Root
+from gem5.components.boards.test_board import TestBoard
+from gem5.components.cachehierarchies.classic.no_cache import NoCache
+from gem5.components.memory import (
+    CXLExpandedMemory,
+    CXLExpanderDDR4_2400,
+    SingleChannelDDR4_2400,
+)
+from gem5.components.processors.linear_generator import LinearGenerator
+
+parser = argparse.ArgumentParser(
+    description="A simple script used to check that a CXL expanded memory "
+    "can be built on a board."
+)
+
+parser.add_argument(
+    "-s",
+    "--size",
+    type=str,
+    default="256MiB",
+    help="The size of each of the local and the CXL memory.",
+)
+
+args = parser.parse_args()
+
+memory = CXLExpandedMemory(
+    local_memory=SingleChannelDDR4_2400(size=args.size),
+    cxl_memory=CXLExpanderDDR4_2400(size=args.size),
+)
+
+local_size = memory.local_memory.get_size()
+
+# only generate traffic to the CXL memory, which is placed right after
+# the local memory
+generator = LinearGenerator(
+    duration="10us",
+    rate="10GB/s",
+    min_addr=local_size,
+    max_addr=memory.get_size(),
+)
+
+motherboard = TestBoard(
+    clk_freq="3GHz",
+    generator=generator,
+    memory=memory,
+    cache_hierarchy=NoCache(),
+)
+
+root = Root(full_system=False, system=motherboard)
+
+motherboard._pre_instantiate()
+
+local_range = memory.local_memory.mem_ctrl[0].dram.range
+cxl_range = memory.cxl_memory.link.ranges[0]
+if int(local_range.start) != 0 or local_range.size() != local_size:
+    raise Exception(f"Unexpected local memory range {local_range}.")
+if int(cxl_range.start) != local_size or cxl_range.size() != local_size:
+    raise Exception(f"Unexpected CXL memory range {cxl_range}.")
+
+m5.instantiate()
+
+generator.start_traffic()
+print("Beginning simulation!")
+exit_event = m5.simulate()
+print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}.")
+